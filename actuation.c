@@ -0,0 +1,212 @@
+#include <stdbool.h>
+#include "em_core.h"
+#include "em_cmu.h"
+#include "em_gpio.h"
+#include "sl_sleeptimer.h"
+#include "app_scheduler.h"
+#include "actuation.h"
+#include "actuation_config.h"
+
+#if ACTUATION_GPIO_COUNT > 4
+#error "actuation_config.h defines pins for at most four GPIO signals"
+#endif
+
+typedef struct {
+    bool steady_on;          // state outside of a pattern
+    bool patterned;
+    bool lit;                // current output during a pattern
+    uint8_t remaining;       // on/off cycles left, 0 = endless
+    uint32_t on_ticks;
+    uint32_t off_ticks;
+    uint32_t next_toggle;    // absolute sleeptimer tick
+} signal_state_t;
+
+#if ACTUATION_GPIO_COUNT > 0
+typedef struct {
+    GPIO_Port_TypeDef port;
+    uint8_t pin;
+    bool active_low;
+} gpio_signal_t;
+
+#define GPIO_SIGNAL(n) { ACTUATION_GPIO##n##_PORT, ACTUATION_GPIO##n##_PIN, ACTUATION_GPIO##n##_ACTIVE_LOW }
+
+static const gpio_signal_t gpio_signals[ACTUATION_GPIO_COUNT] = {
+    GPIO_SIGNAL(0),
+#if ACTUATION_GPIO_COUNT > 1
+    GPIO_SIGNAL(1),
+#endif
+#if ACTUATION_GPIO_COUNT > 2
+    GPIO_SIGNAL(2),
+#endif
+#if ACTUATION_GPIO_COUNT > 3
+    GPIO_SIGNAL(3),
+#endif
+};
+#endif
+
+static signal_state_t signals[ACTUATION_SIGNAL_COUNT];
+static uint8_t pending_codes[ACTUATION_SIGNAL_COUNT];
+static bool pending = false;
+static app_job_t *process_job = NULL;
+static sl_sleeptimer_timer_handle_t pattern_timer;
+
+static void pattern_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data);
+
+static uint32_t ms_to_ticks(uint32_t ms) {
+    uint32_t ticks = 0;
+    if (sl_sleeptimer_ms32_to_tick(ms, &ticks) != SL_STATUS_OK || ticks == 0) {
+        ticks = 1;
+    }
+    return ticks;
+}
+
+static void drive(uint8_t signal, bool on) {
+#if ACTUATION_GPIO_COUNT > 0
+    if (signal >= SL_SIMPLE_LED_COUNT) {
+        const gpio_signal_t *gpio = &gpio_signals[signal - SL_SIMPLE_LED_COUNT];
+        if (on != gpio->active_low) {
+            GPIO_PinOutSet(gpio->port, gpio->pin);
+        } else {
+            GPIO_PinOutClear(gpio->port, gpio->pin);
+        }
+        return;
+    }
+#endif
+    if (on) {
+        sl_led_turn_on(SL_SIMPLE_LED_INSTANCE(signal));
+    } else {
+        sl_led_turn_off(SL_SIMPLE_LED_INSTANCE(signal));
+    }
+}
+
+/**************************************************************************/
+/* One timer serves every running pattern, armed on the earliest toggle.  */
+/* Must be called with interrupts masked.                                 */
+/**************************************************************************/
+static void rearm(void) {
+    uint32_t now = sl_sleeptimer_get_tick_count();
+    uint32_t delay = UINT32_MAX;
+
+    sl_sleeptimer_stop_timer(&pattern_timer);
+    for (uint8_t i = 0; i < ACTUATION_SIGNAL_COUNT; i++) {
+        if (signals[i].patterned) {
+            int32_t remaining = (int32_t)(signals[i].next_toggle - now);
+            uint32_t d = (remaining > 0) ? (uint32_t)remaining : 1;
+            if (d < delay) {
+                delay = d;
+            }
+        }
+    }
+    if (delay != UINT32_MAX) {
+        sl_sleeptimer_start_timer(&pattern_timer, delay, pattern_timer_callback, NULL, 0, 0);
+    }
+}
+
+static void pattern_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    uint32_t now = sl_sleeptimer_get_tick_count();
+
+    for (uint8_t i = 0; i < ACTUATION_SIGNAL_COUNT; i++) {
+        signal_state_t *s = &signals[i];
+        if (!s->patterned || (int32_t)(s->next_toggle - now) > 0) {
+            continue;
+        }
+        if (s->lit) {
+            s->lit = false;
+            s->next_toggle += s->off_ticks;
+            if (s->remaining != 0 && --s->remaining == 0) {
+                // Pattern done: back to the steady state.
+                s->patterned = false;
+                drive(i, s->steady_on);
+                continue;
+            }
+        } else {
+            s->lit = true;
+            s->next_toggle += s->on_ticks;
+        }
+        drive(i, s->lit);
+    }
+    rearm();
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t actuation_init(app_job_t *job) {
+    process_job = job;
+    for (uint8_t i = 0; i < ACTUATION_SIGNAL_COUNT; i++) {
+        signals[i].steady_on = false;
+        signals[i].patterned = false;
+        pending_codes[i] = ACTUATION_CODE_KEEP;
+    }
+#if ACTUATION_GPIO_COUNT > 0
+    CMU_ClockEnable(cmuClock_GPIO, true);
+    for (uint8_t i = 0; i < ACTUATION_GPIO_COUNT; i++) {
+        // Start inactive, like the LEDs.
+        GPIO_PinModeSet(gpio_signals[i].port, gpio_signals[i].pin, gpioModePushPull,
+                        gpio_signals[i].active_low ? 1 : 0);
+    }
+#endif
+    return SL_STATUS_OK;
+}
+
+sl_status_t actuation_write(const uint8_t *data, size_t len) {
+    if (len == 0) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    for (uint8_t i = 0; i < ACTUATION_SIGNAL_COUNT && i / 4 < len; i++) {
+        uint8_t code = (data[i / 4] >> (2 * (i % 4))) & 0x3;
+        if (code != ACTUATION_CODE_KEEP) {
+            pending_codes[i] = code;
+        }
+    }
+    if (!pending) {
+        pending = true;
+        app_scheduler_post(process_job);
+    }
+    return SL_STATUS_OK;
+}
+
+void actuation_process(void) {
+    CORE_DECLARE_IRQ_STATE;
+
+    if (!pending) {
+        return;
+    }
+    pending = false;
+    for (uint8_t i = 0; i < ACTUATION_SIGNAL_COUNT; i++) {
+        uint8_t code = pending_codes[i];
+        pending_codes[i] = ACTUATION_CODE_KEEP;
+        if (code == ACTUATION_CODE_PATTERN) {
+            actuation_set_pattern(i, ACTUATION_PATTERN_ON_MS, ACTUATION_PATTERN_OFF_MS, ACTUATION_PATTERN_COUNT);
+        } else if (code != ACTUATION_CODE_KEEP) {
+            CORE_ENTER_ATOMIC();
+            signals[i].steady_on = (code == ACTUATION_CODE_ON);
+            if (signals[i].patterned) {
+                signals[i].patterned = false;
+                rearm();
+            }
+            drive(i, signals[i].steady_on);
+            CORE_EXIT_ATOMIC();
+        }
+    }
+}
+
+void actuation_set_pattern(uint8_t signal, uint32_t on_ms, uint32_t off_ms, uint8_t count) {
+    CORE_DECLARE_IRQ_STATE;
+
+    if (signal >= ACTUATION_SIGNAL_COUNT) {
+        return;
+    }
+    CORE_ENTER_ATOMIC();
+    signals[signal].on_ticks = ms_to_ticks(on_ms);
+    signals[signal].off_ticks = ms_to_ticks(off_ms);
+    signals[signal].remaining = count;
+    signals[signal].lit = true;
+    signals[signal].patterned = true;
+    signals[signal].next_toggle = sl_sleeptimer_get_tick_count() + signals[signal].on_ticks;
+    drive(signal, true);
+    rearm();
+    CORE_EXIT_ATOMIC();
+}
@@ -0,0 +1,36 @@
+#ifndef ACTUATION_H
+#define ACTUATION_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sl_status.h>
+#include "sl_simple_led_instances.h"
+#include "app_scheduler.h"
+#include "actuation_config.h"
+
+// Digital (2A56) signals driven by the application: signal n is LED n of
+// the simple LED instances, then the ACTUATION_GPIO<n> pins.
+#define ACTUATION_SIGNAL_COUNT   (SL_SIMPLE_LED_COUNT + ACTUATION_GPIO_COUNT)
+
+// 2-bit codes of the Digital characteristic, signal 0 in the low bits.
+#define ACTUATION_CODE_OFF       0x0    // inactive
+#define ACTUATION_CODE_ON        0x1    // active
+#define ACTUATION_CODE_PATTERN   0x2    // tri-state: run the configured blink pattern
+#define ACTUATION_CODE_KEEP      0x3    // unknown: leave the signal as it is
+
+// job is posted when a write is waiting; its handler calls
+// actuation_process().
+sl_status_t actuation_init(app_job_t *job);
+
+// Decode a Digital value. Signals past the end of a shorter value are
+// kept, codes past the last signal are ignored. Writes arriving before the next
+// actuation_process() are merged per signal, so a burst of write
+// commands costs one output update.
+sl_status_t actuation_write(const uint8_t *data, size_t len);
+void actuation_process(void);
+
+// Blink one signal: count on/off cycles (1 is a single pulse, 0 runs
+// until the signal is written again), then back to its steady state.
+void actuation_set_pattern(uint8_t signal, uint32_t on_ms, uint32_t off_ms, uint8_t count);
+
+#endif // ACTUATION_H
@@ -1,129 +1,746 @@
+#include "sl_component_catalog.h"
 #include "em_common.h"
 #include "app_assert.h"
 #include "sl_bluetooth.h"
 #include "app.h"
-#include "app_log.h"
+#define LOG_MODULE APP
+#include "log_module.h"
 #include "sl_status.h"
 #include "sl_sensor_rht.h"
 #include "sl_sensor_light.h"
 #include "sl_simple_led_instances.h"
 #include "sl_sleeptimer.h"
 #include "gatt_db.h"
+#include "rht_async.h"
+#include "sensor_scheduler.h"
+#include "sensor_values.h"
+#include "sensor_filter.h"
+#include "actuation.h"
+#include "measurement_interval.h"
+#include "connection_table.h"
+#include "connection_params.h"
+#include "phy_policy.h"
+#include "link_diagnostics.h"
+#include "em_residency.h"
+#include "sleep_veto.h"
+#include "event_stats.h"
+#include "bt_drain.h"
+#include "app_scheduler.h"
+#include "notify_queue.h"
+#include "event_stats_config.h"
+#include "cycle_counter.h"
+#include "profiler.h"
+#include "binlog.h"
+#include "sample_batch.h"
+#include "broadcast.h"
+#include "broadcast_config.h"
+#include "periodic_broadcast.h"
+#include "periodic_broadcast_config.h"
+#include "history_log.h"
+#include "history_log_config.h"
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+#include "app_tasks.h"
+#endif
 
-#define TEMPERATURE_TIMER_SIGNAL (1 << 0)
+// Job priorities, higher runs first.
+#define JOB_PRIORITY_ACTUATION       3
+#define JOB_PRIORITY_READ_SAMPLE     2
+#define JOB_PRIORITY_NOTIFY_RETRY    1
+#define JOB_PRIORITY_BATCH_FLUSH     0
+#define JOB_PRIORITY_HISTORY_ERASE   0
+
+// Common Profile and Service Error Codes.
+#define ATT_ERRCODE_CCCD_IMPROPERLY_CONFIGURED 0xFD
+#define ATT_ERRCODE_PROCEDURE_IN_PROGRESS      0xFE
+#define ATT_ERRCODE_OUT_OF_RANGE               0xFF
+
+#define RHT_SENSOR_MASK (SENSOR_MASK(SENSOR_ID_TEMPERATURE) | SENSOR_MASK(SENSOR_ID_HUMIDITY))
 
 static uint8_t advertising_set_handle = 0xff;
-static bool notifications_enabled = false;
-static sl_sleeptimer_timer_handle_t sensing_timer;
+
+// External signal bits of the modules that raise Bluetooth events,
+// handed out by app_scheduler_alloc_signal().
+static uint32_t sensor_due_signal = 0;
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+static uint32_t sensor_result_signal = 0;
+#else
+static uint32_t rht_ready_signal = 0;
+#endif
+static uint32_t params_relax_signal = 0;
+static uint32_t history_signal = 0;
+static uint32_t event_stats_signal = 0;
+static uint32_t em_residency_signal = 0;
+
+// Deferred work without a Bluetooth event of its own.
+static app_job_t actuation_job;
+#if !defined(SL_CATALOG_KERNEL_PRESENT)
+static app_job_t read_sample_job;
+#endif
+static app_job_t notify_retry_job;
+static app_job_t batch_flush_job;
+#if HISTORY_LOG_ENABLE
+static app_job_t history_erase_job;
+#endif
+
+static uint32_t rht_wanted = 0;        // Sensors waiting on the RHT acquisition.
+static bool irradiance_due = false;    // Scheduled light sample not yet taken.
+#if !defined(SL_CATALOG_KERNEL_PRESENT)
+static bool irradiance_deferred = false;
+static bool irradiance_read_wanted = false;
+#endif
 
 /**************************************************************************/
-/* Timer Callback                                                         */
+/* Send Notification                                                      */
 /**************************************************************************/
-void sensing_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
-    (void)handle;
-    (void)data;
-    if (notifications_enabled) {
-        sl_bt_external_signal(TEMPERATURE_TIMER_SIGNAL);
-    }
+static void notify(uint16_t characteristic, const uint8_t *data, size_t len) {
+    // One sample, fanned out to every subscribed peer. Peers whose stack
+    // buffers are full get it later, or a newer sample instead.
+    PROFILER_BEGIN(PROFILER_ZONE_NOTIFY);
+    notify_queue_send_all(characteristic, len, data);
+    PROFILER_END(PROFILER_ZONE_NOTIFY);
 }
 
 /**************************************************************************/
-/* Application Initialization                                             */
+/* Sensor of an Environmental Sensing characteristic                      */
 /**************************************************************************/
-void app_init(void) {
-    app_log_info("%s\n", __FUNCTION__);
-    sl_sensor_rht_init();
-    sl_simple_led_init_instances();
-    app_log_info("Sensors and LEDs initialized.\n");
+static sensor_id_t sensor_from_characteristic(uint16_t characteristic) {
+    if (characteristic == gattdb_humidity_0) {
+        return SENSOR_ID_HUMIDITY;
+    }
+    if (characteristic == gattdb_irradiance_0) {
+        return SENSOR_ID_IRRADIANCE;
+    }
+    return SENSOR_ID_TEMPERATURE;
 }
 
 /**************************************************************************/
-/* Start Sensing Timer                                                    */
+/* Cached Sensor Reads                                                    */
+/* Reads are answered from the last sample. A stale value is re-sampled   */
+/* asynchronously and the read answered when it arrives; concurrent stale */
+/* reads share one acquisition.                                           */
 /**************************************************************************/
-void start_sensing_timer(void) {
-    sl_status_t sc = sl_sleeptimer_start_periodic_timer_ms(
-        &sensing_timer,
-        1000, // 1 second interval
-        sensing_timer_callback,
-        NULL,
-        0,
-        0
-    );
-    if (sc == SL_STATUS_OK) {
-        app_log_info("Sensing Timer started.\n");
+static void answer_pending_reads(uint32_t sensors, uint8_t att_errcode) {
+    for (uint8_t i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        connection_entry_t *entry = connection_table_at(i);
+        if (entry == NULL || entry->pending_read == 0
+            || !(sensors & SENSOR_MASK(sensor_from_characteristic(entry->pending_read)))) {
+            continue;
+        }
+        sl_bt_gatt_server_send_user_read_response(entry->handle,
+                                                  entry->pending_read,
+                                                  att_errcode,
+                                                  (att_errcode == 0) ? SENSOR_VALUE_SIZE : 0,
+                                                  sensor_value_get(sensor_from_characteristic(entry->pending_read)),
+                                                  NULL);
+        entry->pending_read = 0;
+    }
+}
+
+static void read_sensor(uint8_t connection, uint16_t characteristic) {
+    sensor_id_t id = sensor_from_characteristic(characteristic);
+    connection_entry_t *entry = (connection != CONNECTION_HANDLE_INVALID)
+                                ? connection_table_find(connection) : NULL;
+
+    // Untracked peers get the cached value whatever its age.
+    if (sensor_value_is_fresh(id) || entry == NULL) {
+        sl_bt_gatt_server_send_user_read_response(connection,
+                                                  characteristic,
+                                                  0,
+                                                  SENSOR_VALUE_SIZE,
+                                                  sensor_value_get(id),
+                                                  NULL);
+        return;
+    }
+    entry->pending_read = characteristic;
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+    app_tasks_request_sensors((id == SENSOR_ID_IRRADIANCE) ? SENSOR_MASK(id) : RHT_SENSOR_MASK);
+#else
+    if (id == SENSOR_ID_IRRADIANCE) {
+        // The light read blocks on I2C; take it from the main loop.
+        irradiance_read_wanted = true;
+        app_scheduler_post(&read_sample_job);
     } else {
-        app_log_error("Failed to start sensing timer: 0x%lX\n", sc);
+        // Joins an acquisition already running, if any.
+        sl_status_t sc = rht_async_start();
+        if (sc != SL_STATUS_OK && sc != SL_STATUS_BUSY) {
+            LOG_ERROR("Failed to start RHT acquisition: 0x%lX\n", sc);
+            answer_pending_reads(RHT_SENSOR_MASK, sl_bt_att_errcode_unlikely_error);
+        }
     }
+#endif
 }
 
 /**************************************************************************/
-/* Stop Sensing Timer                                                     */
+/* Subscription Refresh                                                   */
 /**************************************************************************/
-void stop_sensing_timer(void) {
-    sl_status_t sc = sl_sleeptimer_stop_timer(&sensing_timer);
-    if (sc == SL_STATUS_OK) {
-        app_log_info("Sensing Timer stopped.\n");
-    } else {
-        app_log_error("Failed to stop sensing timer: 0x%lX\n", sc);
+static void refresh_subscriptions(void) {
+    // Broadcasting, the history log and Batched Samples subscribers want
+    // every sensor.
+    bool all_sensors = BROADCAST_ENABLE
+                       || PERIODIC_BROADCAST_ENABLE
+                       || (HISTORY_LOG_ENABLE && history_log_is_ready())
+                       || connection_table_any_subscribed(gattdb_batched_samples);
+
+    sensor_scheduler_set_subscribed(SENSOR_ID_TEMPERATURE, all_sensors || connection_table_any_subscribed(gattdb_temperature));
+    sensor_scheduler_set_subscribed(SENSOR_ID_HUMIDITY, all_sensors || connection_table_any_subscribed(gattdb_humidity_0));
+    sensor_scheduler_set_subscribed(SENSOR_ID_IRRADIANCE, all_sensors || connection_table_any_subscribed(gattdb_irradiance_0));
+}
+
+/**************************************************************************/
+/* Advertising                                                            */
+/**************************************************************************/
+static void start_advertising(void) {
+#if BROADCAST_ENABLE && !BROADCAST_CONNECTABLE
+    // Pure beacon: readings go out in the advertising payload only.
+    sl_status_t sc = sl_bt_legacy_advertiser_start(advertising_set_handle, sl_bt_legacy_advertiser_scannable);
+#else
+    // Keep advertising while connection slots are left so further
+    // gateways can connect.
+    if (connection_table_count() >= CONNECTION_TABLE_SIZE) {
+        return;
+    }
+    sl_status_t sc = sl_bt_legacy_advertiser_start(advertising_set_handle, sl_bt_legacy_advertiser_connectable);
+#endif
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to start advertising: 0x%lX\n", sc);
     }
 }
 
+/**************************************************************************/
+/* Irradiance Sampling                                                    */
+/**************************************************************************/
+static void publish_irradiance(sl_status_t sc, float lux) {
+    bool scheduled = irradiance_due;
+
+    irradiance_due = false;
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to read light sensor: 0x%lX\n", sc);
+        answer_pending_reads(SENSOR_MASK(SENSOR_ID_IRRADIANCE), sl_bt_att_errcode_unlikely_error);
+        return;
+    }
+    uint16_t irradiance = sensor_value_set_irradiance(lux, scheduled);
+    answer_pending_reads(SENSOR_MASK(SENSOR_ID_IRRADIANCE), 0);
+    if (!scheduled) {
+        // Taken for a stale read only.
+        return;
+    }
+    // Only notifications are thinned out; the other consumers keep every sample.
+    if (sensor_filter_should_notify(SENSOR_ID_IRRADIANCE)) {
+        notify(gattdb_irradiance_0, sensor_value_get(SENSOR_ID_IRRADIANCE), SENSOR_VALUE_SIZE);
+    }
+    sample_batch_push(SENSOR_ID_IRRADIANCE, irradiance);
+    broadcast_set_reading(SENSOR_ID_IRRADIANCE, irradiance);
+    periodic_broadcast_push(SENSOR_ID_IRRADIANCE, irradiance);
+    history_log_append(SENSOR_ID_IRRADIANCE, irradiance);
+    PROFILER_BEGIN(PROFILER_ZONE_LOG);
+    BINLOG_INFO(IRRADIANCE_SENT, irradiance);
+    PROFILER_END(PROFILER_ZONE_LOG);
+}
+
+#if !defined(SL_CATALOG_KERNEL_PRESENT)
+static void sample_irradiance(void) {
+    float lux;
+    float uvi;
+
+    // The Si1133 read is a blocking I2CSPM transfer on the same bus as the
+    // Si7021, so it must not overlap an asynchronous RHT acquisition.
+    if (rht_async_is_busy()) {
+        irradiance_deferred = true;
+        return;
+    }
+    irradiance_deferred = false;
+    irradiance_read_wanted = false;
+
+    PROFILER_BEGIN(PROFILER_ZONE_LIGHT_READ);
+    sl_status_t sc = sl_sensor_light_get(&lux, &uvi);
+    PROFILER_END(PROFILER_ZONE_LIGHT_READ);
+    publish_irradiance(sc, lux);
+}
+#endif
+
+/**************************************************************************/
+/* RHT Result                                                             */
+/**************************************************************************/
+static void publish_rht(const rht_async_result_t *rht) {
+    uint32_t wanted = rht_wanted & sensor_scheduler_get_subscribed();
+
+    rht_wanted = 0;
+    if (rht->status != SL_STATUS_OK) {
+        LOG_ERROR("RHT acquisition failed: 0x%lX\n", rht->status);
+        answer_pending_reads(RHT_SENSOR_MASK, sl_bt_att_errcode_unlikely_error);
+        return;
+    }
+
+    // One acquisition measures both, so both cached values are refreshed
+    // and any read waiting on either is answered.
+    uint16_t temperature = sensor_value_set_temperature(rht->temperature,
+                                                        (wanted & SENSOR_MASK(SENSOR_ID_TEMPERATURE)) != 0);
+    uint16_t humidity = sensor_value_set_humidity(rht->rh, (wanted & SENSOR_MASK(SENSOR_ID_HUMIDITY)) != 0);
+    answer_pending_reads(RHT_SENSOR_MASK, 0);
+
+    if (wanted & SENSOR_MASK(SENSOR_ID_TEMPERATURE)) {
+        if (sensor_filter_should_notify(SENSOR_ID_TEMPERATURE)) {
+            notify(gattdb_temperature, sensor_value_get(SENSOR_ID_TEMPERATURE), SENSOR_VALUE_SIZE);
+        }
+        sample_batch_push(SENSOR_ID_TEMPERATURE, temperature);
+        broadcast_set_reading(SENSOR_ID_TEMPERATURE, temperature);
+        periodic_broadcast_push(SENSOR_ID_TEMPERATURE, temperature);
+        history_log_append(SENSOR_ID_TEMPERATURE, temperature);
+        PROFILER_BEGIN(PROFILER_ZONE_LOG);
+        BINLOG_INFO(TEMPERATURE_SENT, (int16_t)temperature);
+        PROFILER_END(PROFILER_ZONE_LOG);
+    }
+    if (wanted & SENSOR_MASK(SENSOR_ID_HUMIDITY)) {
+        if (sensor_filter_should_notify(SENSOR_ID_HUMIDITY)) {
+            notify(gattdb_humidity_0, sensor_value_get(SENSOR_ID_HUMIDITY), SENSOR_VALUE_SIZE);
+        }
+        sample_batch_push(SENSOR_ID_HUMIDITY, humidity);
+        broadcast_set_reading(SENSOR_ID_HUMIDITY, humidity);
+        periodic_broadcast_push(SENSOR_ID_HUMIDITY, humidity);
+        history_log_append(SENSOR_ID_HUMIDITY, humidity);
+        PROFILER_BEGIN(PROFILER_ZONE_LOG);
+        BINLOG_INFO(HUMIDITY_SENT, humidity);
+        PROFILER_END(PROFILER_ZONE_LOG);
+    }
+}
+
+#if !defined(SL_CATALOG_KERNEL_PRESENT)
+static void handle_rht_ready(void) {
+    rht_async_result_t rht;
+
+    rht_async_get_result(&rht);
+    publish_rht(&rht);
+}
+#endif
+
+/**************************************************************************/
+/* Jobs                                                                   */
+/**************************************************************************/
+#if !defined(SL_CATALOG_KERNEL_PRESENT)
+static void read_sample(void) {
+    // Still deferred if an RHT acquisition holds the bus.
+    if (irradiance_read_wanted) {
+        sample_irradiance();
+    }
+}
+#endif
+
+static void flush_batch(void) {
+    // A backlog spanning several notifications is a burst.
+    if (sample_batch_flush() > 1) {
+        connection_params_burst_subscribers(gattdb_batched_samples);
+    }
+}
+
+/**************************************************************************/
+/* Power Report                                                           */
+/**************************************************************************/
+// Kernel builds run this in the report task. Each *_log() copies the
+// state it prints inside an atomic section, which also keeps the event
+// task off the CPU, and formats the copy.
+static void report_power(void) {
+    em_residency_log();
+    sleep_veto_log();
+    bt_drain_log();
+    notify_queue_log();
+    app_scheduler_log();
+    sensor_filter_log();
+}
+
+/**************************************************************************/
+/* Application Initialization                                             */
+/**************************************************************************/
+void app_init(void) {
+    LOG_INFO("%s\n", __FUNCTION__);
+    sl_sensor_rht_init();
+    sl_sensor_light_init();
+
+    // Before any other module takes a signal or posts a job.
+    app_scheduler_init();
+    sensor_due_signal = app_scheduler_alloc_signal();
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+    sensor_result_signal = app_scheduler_alloc_signal();
+#else
+    rht_ready_signal = app_scheduler_alloc_signal();
+#endif
+    params_relax_signal = app_scheduler_alloc_signal();
+    history_signal = app_scheduler_alloc_signal();
+    event_stats_signal = app_scheduler_alloc_signal();
+    em_residency_signal = app_scheduler_alloc_signal();
+    app_scheduler_add(&actuation_job, "actuation", JOB_PRIORITY_ACTUATION, actuation_process);
+#if !defined(SL_CATALOG_KERNEL_PRESENT)
+    app_scheduler_add(&read_sample_job, "read sample", JOB_PRIORITY_READ_SAMPLE, read_sample);
+#endif
+    app_scheduler_add(&notify_retry_job, "notify retry", JOB_PRIORITY_NOTIFY_RETRY, notify_queue_process);
+    app_scheduler_add(&batch_flush_job, "batch flush", JOB_PRIORITY_BATCH_FLUSH, flush_batch);
+#if HISTORY_LOG_ENABLE
+    app_scheduler_add(&history_erase_job, "history erase", JOB_PRIORITY_HISTORY_ERASE, history_log_erase_poll);
+#endif
+
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+    app_tasks_init(sensor_result_signal);
+#else
+    rht_async_init(rht_ready_signal);
+#endif
+    sensor_scheduler_init(sensor_due_signal);
+    sensor_filter_init();
+    connection_table_init();
+    notify_queue_init(&notify_retry_job);
+    connection_params_init(params_relax_signal);
+    event_stats_init(event_stats_signal);
+    em_residency_init(em_residency_signal);
+    profiler_init();
+    binlog_init();
+#if HISTORY_LOG_ENABLE
+    history_log_init(history_signal, &history_erase_job);
+#endif
+    sample_batch_init(&batch_flush_job);
+    sl_simple_led_init_instances();
+    actuation_init(&actuation_job);
+    LOG_INFO("Sensors and LEDs initialized.\n");
+}
+
+/**************************************************************************/
+/* Application Process Action                                             */
+/**************************************************************************/
+void app_process_action(void) {
+    // The MCU stays awake while jobs are pending, so each loop pass
+    // gets to them before the next sleep.
+    app_scheduler_run();
+    // Absorb event bursts in this loop pass rather than one per pass.
+    bt_drain_process();
+}
+
 /**************************************************************************/
 /* Bluetooth Event Handler                                                */
 /**************************************************************************/
-void sl_bt_on_event(sl_bt_msg_t *evt) {
+static void handle_event(sl_bt_msg_t *evt) {
     switch (SL_BT_MSG_ID(evt->header)) {
 
     case sl_bt_evt_system_boot_id:
         sl_bt_advertiser_create_set(&advertising_set_handle);
-        sl_bt_legacy_advertiser_start(advertising_set_handle, sl_bt_legacy_advertiser_connectable);
+#if BROADCAST_ENABLE
+        broadcast_init(advertising_set_handle);
+#else
+        sl_bt_legacy_advertiser_generate_data(advertising_set_handle, sl_bt_advertiser_general_discoverable);
+#endif
+        start_advertising();
+#if PERIODIC_BROADCAST_ENABLE
+        periodic_broadcast_start();
+#endif
+        measurement_interval_init();
+        refresh_subscriptions();
+        break;
+
+    case sl_bt_evt_connection_opened_id:
+        connection_table_open(evt->data.evt_connection_opened.connection);
+        // Service discovery follows; relax once it is over.
+        connection_params_burst(evt->data.evt_connection_opened.connection);
+        LOG_INFO("Connection %u opened, %u active.\n",
+                 evt->data.evt_connection_opened.connection,
+                 connection_table_count());
+        start_advertising();
+        break;
+
+    case sl_bt_evt_connection_closed_id:
+        // The stack forgets the CCCDs of a closed connection without
+        // raising characteristic_status events for them.
+        connection_table_close(evt->data.evt_connection_closed.connection);
+        notify_queue_close(evt->data.evt_connection_closed.connection);
+        history_log_stream_stop(evt->data.evt_connection_closed.connection);
+        refresh_subscriptions();
+        LOG_INFO("Connection %u closed, reason 0x%X.\n",
+                 evt->data.evt_connection_closed.connection,
+                 evt->data.evt_connection_closed.reason);
+        start_advertising();
+        break;
+
+    case sl_bt_evt_connection_parameters_id:
+        connection_params_on_parameters(evt->data.evt_connection_parameters.connection,
+                                        evt->data.evt_connection_parameters.interval,
+                                        evt->data.evt_connection_parameters.latency,
+                                        evt->data.evt_connection_parameters.timeout);
+        link_diagnostics_update(evt->data.evt_connection_parameters.connection);
+        break;
+
+    case sl_bt_evt_connection_phy_status_id:
+        phy_policy_on_phy_status(evt->data.evt_connection_phy_status.connection,
+                                 evt->data.evt_connection_phy_status.phy);
+        link_diagnostics_update(evt->data.evt_connection_phy_status.connection);
+        break;
+
+    case sl_bt_evt_gatt_mtu_exchanged_id:
+        connection_table_set_mtu(evt->data.evt_gatt_mtu_exchanged.connection,
+                                 evt->data.evt_gatt_mtu_exchanged.mtu);
+        link_diagnostics_update(evt->data.evt_gatt_mtu_exchanged.connection);
         break;
 
     case sl_bt_evt_gatt_server_characteristic_status_id:
-        if (evt->data.evt_gatt_server_characteristic_status.characteristic == gattdb_temperature) {
-            app_log_info(
-                "Characteristic status changed: Characteristic=%d, StatusFlags=0x%X, ClientConfigFlags=0x%X\n",
-                evt->data.evt_gatt_server_characteristic_status.characteristic,
-                evt->data.evt_gatt_server_characteristic_status.status_flags,
-                evt->data.evt_gatt_server_characteristic_status.client_config_flags
+        LOG_INFO(
+            "Characteristic status changed: Characteristic=%d, StatusFlags=0x%X, ClientConfigFlags=0x%X\n",
+            evt->data.evt_gatt_server_characteristic_status.characteristic,
+            evt->data.evt_gatt_server_characteristic_status.status_flags,
+            evt->data.evt_gatt_server_characteristic_status.client_config_flags
+        );
+
+        if (evt->data.evt_gatt_server_characteristic_status.status_flags & sl_bt_gatt_server_client_config) {
+            bool enabled = (evt->data.evt_gatt_server_characteristic_status.client_config_flags & gatt_notification) != 0;
+            if (!connection_table_set_notify(evt->data.evt_gatt_server_characteristic_status.connection,
+                                             evt->data.evt_gatt_server_characteristic_status.characteristic,
+                                             enabled)) {
+                break;
+            }
+            if (!enabled
+                && evt->data.evt_gatt_server_characteristic_status.characteristic == gattdb_batched_samples) {
+                // Hand what is buffered to the remaining subscribers, if any.
+                sample_batch_flush();
+            }
+            if (!enabled
+                && evt->data.evt_gatt_server_characteristic_status.characteristic == gattdb_history) {
+                history_log_stream_stop(evt->data.evt_gatt_server_characteristic_status.connection);
+            }
+            if (enabled
+                && (evt->data.evt_gatt_server_characteristic_status.characteristic == gattdb_temperature
+                    || evt->data.evt_gatt_server_characteristic_status.characteristic == gattdb_humidity_0
+                    || evt->data.evt_gatt_server_characteristic_status.characteristic == gattdb_irradiance_0)) {
+                // A new subscriber should not wait for the deadband or heartbeat.
+                sensor_filter_notify_next(sensor_from_characteristic(evt->data.evt_gatt_server_characteristic_status.characteristic));
+            }
+            if (enabled
+                && evt->data.evt_gatt_server_characteristic_status.characteristic == gattdb_link_diagnostics) {
+                link_diagnostics_update(evt->data.evt_gatt_server_characteristic_status.connection);
+            }
+            refresh_subscriptions();
+            LOG_INFO("Notifications %s for characteristic %d on connection %u, subscribed mask 0x%lX.\n",
+                     enabled ? "enabled" : "disabled",
+                     evt->data.evt_gatt_server_characteristic_status.characteristic,
+                     evt->data.evt_gatt_server_characteristic_status.connection,
+                     sensor_scheduler_get_subscribed());
+        }
+        break;
+
+    case sl_bt_evt_gatt_server_user_read_request_id:
+        if (evt->data.evt_gatt_server_user_read_request.characteristic == gattdb_temperature
+            || evt->data.evt_gatt_server_user_read_request.characteristic == gattdb_humidity_0
+            || evt->data.evt_gatt_server_user_read_request.characteristic == gattdb_irradiance_0) {
+            read_sensor(evt->data.evt_gatt_server_user_read_request.connection,
+                        evt->data.evt_gatt_server_user_read_request.characteristic);
+        } else if (evt->data.evt_gatt_server_user_read_request.characteristic == gattdb_measurement_interval) {
+            uint16_t interval = measurement_interval_get();
+            uint8_t interval_data[2] = { interval & 0xFF, (interval >> 8) & 0xFF };
+            sl_bt_gatt_server_send_user_read_response(
+                evt->data.evt_gatt_server_user_read_request.connection,
+                gattdb_measurement_interval,
+                0,
+                sizeof(interval_data),
+                interval_data,
+                NULL
+            );
+        } else if (evt->data.evt_gatt_server_user_read_request.characteristic == gattdb_link_diagnostics) {
+            uint8_t diagnostics_data[LINK_DIAGNOSTICS_SIZE];
+            size_t len = link_diagnostics_encode(evt->data.evt_gatt_server_user_read_request.connection,
+                                                 diagnostics_data);
+            sl_bt_gatt_server_send_user_read_response(
+                evt->data.evt_gatt_server_user_read_request.connection,
+                gattdb_link_diagnostics,
+                0,
+                len,
+                diagnostics_data,
+                NULL
+            );
+        } else if (evt->data.evt_gatt_server_user_read_request.characteristic == gattdb_power_diagnostics) {
+            uint8_t residency_data[EM_RESIDENCY_ENCODED_SIZE];
+            size_t len = em_residency_encode(residency_data);
+            sl_bt_gatt_server_send_user_read_response(
+                evt->data.evt_gatt_server_user_read_request.connection,
+                gattdb_power_diagnostics,
+                0,
+                len,
+                residency_data,
+                NULL
             );
+        } else if (evt->data.evt_gatt_server_user_read_request.characteristic == gattdb_log_levels) {
+            uint8_t levels_data[LOG_MODULE_ENCODED_SIZE];
+            size_t len = log_module_encode(levels_data);
+            sl_bt_gatt_server_send_user_read_response(
+                evt->data.evt_gatt_server_user_read_request.connection,
+                gattdb_log_levels,
+                0,
+                len,
+                levels_data,
+                NULL
+            );
+        }
+        break;
 
-            if (evt->data.evt_gatt_server_characteristic_status.status_flags & sl_bt_gatt_server_client_config) {
-                if (evt->data.evt_gatt_server_characteristic_status.client_config_flags == gatt_notification) {
-                    notifications_enabled = true;
-                    start_sensing_timer();
-                    app_log_info("Notifications enabled for Temperature characteristic.\n");
-                } else if (evt->data.evt_gatt_server_characteristic_status.client_config_flags == 0) {
-                    notifications_enabled = false;
-                    stop_sensing_timer();
-                    app_log_info("Notifications disabled for Temperature characteristic.\n");
+    case sl_bt_evt_gatt_server_user_write_request_id:
+        if (evt->data.evt_gatt_server_user_write_request.characteristic == gattdb_measurement_interval) {
+            uint8_t att_errcode = 0;
+            if (evt->data.evt_gatt_server_user_write_request.value.len != 2) {
+                att_errcode = sl_bt_att_errcode_invalid_att_length;
+            } else {
+                uint32_t interval = evt->data.evt_gatt_server_user_write_request.value.data[0]
+                                    | (evt->data.evt_gatt_server_user_write_request.value.data[1] << 8);
+                if (measurement_interval_set(interval) != SL_STATUS_OK) {
+                    att_errcode = ATT_ERRCODE_OUT_OF_RANGE;
+                }
+            }
+            sl_bt_gatt_server_send_user_write_response(
+                evt->data.evt_gatt_server_user_write_request.connection,
+                gattdb_measurement_interval,
+                att_errcode
+            );
+        } else if (evt->data.evt_gatt_server_user_write_request.characteristic == gattdb_history) {
+            uint8_t connection = evt->data.evt_gatt_server_user_write_request.connection;
+            uint8_t att_errcode = 0;
+            if (evt->data.evt_gatt_server_user_write_request.value.len != 4) {
+                att_errcode = sl_bt_att_errcode_invalid_att_length;
+            } else if (!connection_table_is_subscribed(connection_table_find(connection), gattdb_history)) {
+                att_errcode = ATT_ERRCODE_CCCD_IMPROPERLY_CONFIGURED;
+            } else {
+                const uint8_t *data = evt->data.evt_gatt_server_user_write_request.value.data;
+                uint32_t from_seq = data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+                sl_status_t sc = history_log_stream_start(connection, from_seq);
+                if (sc == SL_STATUS_BUSY) {
+                    att_errcode = ATT_ERRCODE_PROCEDURE_IN_PROGRESS;
+                } else if (sc != SL_STATUS_OK) {
+                    att_errcode = sl_bt_att_errcode_request_not_supported;
+                } else {
+                    connection_params_burst(connection);
                 }
             }
+            sl_bt_gatt_server_send_user_write_response(connection, gattdb_history, att_errcode);
+        } else if (evt->data.evt_gatt_server_user_write_request.characteristic == gattdb_digital) {
+            sl_status_t sc = actuation_write(evt->data.evt_gatt_server_user_write_request.value.data,
+                                             evt->data.evt_gatt_server_user_write_request.value.len);
+            // Write commands get no response.
+            if (evt->data.evt_gatt_server_user_write_request.att_opcode == sl_bt_gatt_write_request) {
+                sl_bt_gatt_server_send_user_write_response(
+                    evt->data.evt_gatt_server_user_write_request.connection,
+                    gattdb_digital,
+                    (sc == SL_STATUS_OK) ? 0 : sl_bt_att_errcode_invalid_att_length
+                );
+            }
+        } else if (evt->data.evt_gatt_server_user_write_request.characteristic == gattdb_log_levels) {
+            uint8_t att_errcode = 0;
+            sl_status_t sc = log_module_decode(evt->data.evt_gatt_server_user_write_request.value.data,
+                                               evt->data.evt_gatt_server_user_write_request.value.len);
+            if (sc == SL_STATUS_INVALID_PARAMETER) {
+                att_errcode = sl_bt_att_errcode_invalid_att_length;
+            } else if (sc != SL_STATUS_OK) {
+                att_errcode = ATT_ERRCODE_OUT_OF_RANGE;
+            }
+            sl_bt_gatt_server_send_user_write_response(
+                evt->data.evt_gatt_server_user_write_request.connection,
+                gattdb_log_levels,
+                att_errcode
+            );
         }
         break;
 
     case sl_bt_evt_system_external_signal_id:
-        if (evt->data.evt_system_external_signal.extsignals & TEMPERATURE_TIMER_SIGNAL) {
-            uint8_t temperature_data[2];
-            int32_t temperature;
-            size_t temperature_len = 2;
-
-            if (sl_sensor_rht_get(NULL, &temperature) == SL_STATUS_OK) {
-                int16_t formatted_temperature = (int16_t)(temperature / 10);
-                memcpy(temperature_data, &formatted_temperature, sizeof(formatted_temperature));
-
-                sl_bt_gatt_server_send_notification(
-                    evt->data.evt_gatt_server_user_read_request.connection,
-                    gattdb_temperature,
-                    temperature_len,
-                    temperature_data
-                );
-                app_log_info("Temperature notification sent: %d deci-Celsius.\n", formatted_temperature);
+        if (evt->data.evt_system_external_signal.extsignals & sensor_due_signal) {
+            uint32_t due = sensor_scheduler_take_due();
+
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+            // The sensor task owns the bus and takes both reads in turn.
+            if (due & SENSOR_MASK(SENSOR_ID_IRRADIANCE)) {
+                irradiance_due = true;
+            }
+            rht_wanted |= due & RHT_SENSOR_MASK;
+            app_tasks_request_sensors(due);
+#else
+            // Light first: its blocking read cannot share the bus with the
+            // asynchronous RHT acquisition started below.
+            if (due & SENSOR_MASK(SENSOR_ID_IRRADIANCE)) {
+                irradiance_due = true;
+                sample_irradiance();
             }
+            // One Si7021 acquisition serves both temperature and humidity.
+            if (due & RHT_SENSOR_MASK) {
+                rht_wanted |= due & RHT_SENSOR_MASK;
+                sl_status_t sc = rht_async_start();
+                if (sc != SL_STATUS_OK && sc != SL_STATUS_BUSY) {
+                    LOG_ERROR("Failed to start RHT acquisition: 0x%lX\n", sc);
+                }
+            }
+#endif
         }
+
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+        if (evt->data.evt_system_external_signal.extsignals & sensor_result_signal) {
+            app_tasks_sensor_result_t result;
+
+            while (app_tasks_take_sensor_result(&result)) {
+                if (result.sensors & SENSOR_MASK(SENSOR_ID_IRRADIANCE)) {
+                    publish_irradiance(result.light_status, result.lux);
+                }
+                if (result.sensors & RHT_SENSOR_MASK) {
+                    PROFILER_BEGIN(PROFILER_ZONE_RHT_RESULT);
+                    publish_rht(&result.rht);
+                    PROFILER_END(PROFILER_ZONE_RHT_RESULT);
+                }
+            }
+        }
+#else
+        if (evt->data.evt_system_external_signal.extsignals & rht_ready_signal) {
+            PROFILER_BEGIN(PROFILER_ZONE_RHT_RESULT);
+            handle_rht_ready();
+            PROFILER_END(PROFILER_ZONE_RHT_RESULT);
+            if (irradiance_deferred) {
+                sample_irradiance();
+            }
+        }
+#endif
+
+        // Kernel builds have no super loop; jobs run from this task.
+        if (evt->data.evt_system_external_signal.extsignals & app_scheduler_signal()) {
+            app_scheduler_run();
+        }
+
+        if (evt->data.evt_system_external_signal.extsignals & params_relax_signal) {
+            connection_params_process();
+        }
+
+        if (evt->data.evt_system_external_signal.extsignals & event_stats_signal) {
+            event_stats_report();
+        }
+
+        if (evt->data.evt_system_external_signal.extsignals & em_residency_signal) {
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+            // Formatting the report is slow; keep it out of the event task.
+            if (app_tasks_defer_report(report_power) != SL_STATUS_OK) {
+                LOG_WARNING("Power report skipped, report task busy.\n");
+            }
+#else
+            report_power();
+#endif
+        }
+
+        if (evt->data.evt_system_external_signal.extsignals & history_signal) {
+            history_log_stream_continue();
+            // Hold the burst profile for as long as the download runs.
+            if (history_log_stream_connection() != CONNECTION_HANDLE_INVALID) {
+                connection_params_burst(history_log_stream_connection());
+            }
+        }
+
+        // One advertising payload update per sampling round.
+        broadcast_refresh();
+        periodic_broadcast_refresh();
         break;
 
     default:
         break;
     }
 }
+
+void sl_bt_on_event(sl_bt_msg_t *evt) {
+#if EVENT_STATS_ENABLE
+    uint32_t start = cycle_counter_get();
+    handle_event(evt);
+    event_stats_record(SL_BT_MSG_ID(evt->header), cycle_counter_get() - start);
+#else
+    handle_event(evt);
+#endif
+}
@@ -0,0 +1,10 @@
+#include "sl_sleeptimer.h"
+#include "app_clock.h"
+
+#if !defined(APP_CLOCK_VIRTUAL)
+uint32_t app_clock_ms(void) {
+    uint64_t ms = 0;
+    sl_sleeptimer_tick64_to_ms(sl_sleeptimer_get_tick_count64(), &ms);
+    return (uint32_t)ms;
+}
+#endif
@@ -0,0 +1,23 @@
+#ifndef APP_CLOCK_H
+#define APP_CLOCK_H
+
+#include <stdint.h>
+
+/**************************************************************************/
+/* Time source for sample timestamps.                                     */
+/*                                                                        */
+/* Everything that stamps samples reads the time here. The host build     */
+/* (host/CMakeLists.txt) defines APP_CLOCK_VIRTUAL and reads the          */
+/* simulator's virtual clock instead, which only moves when a test or a   */
+/* trace replay advances it.                                              */
+/**************************************************************************/
+
+// Milliseconds since boot, wrapping after about 49.7 days.
+#if defined(APP_CLOCK_VIRTUAL)
+#include "sim_clock.h"
+#define app_clock_ms()  sim_clock_ms()
+#else
+uint32_t app_clock_ms(void);
+#endif
+
+#endif // APP_CLOCK_H
@@ -0,0 +1,248 @@
+#include <stddef.h>
+#include "sl_component_catalog.h"
+#include "em_core.h"
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#include "app_scheduler.h"
+#include "app_scheduler_config.h"
+#define LOG_MODULE APP
+#include "log_module.h"
+
+#if APP_SCHEDULER_MAX_JOBS > 32
+#error "APP_SCHEDULER_MAX_JOBS must fit a 32-bit mask"
+#endif
+
+// Jobs in run order, highest priority first. Bit n of the masks below is
+// jobs[n]; the masks are shared with the timer callback.
+static app_job_t *jobs[APP_SCHEDULER_MAX_JOBS];
+static uint8_t job_count = 0;
+static volatile uint32_t pending_mask = 0;
+static uint32_t timed_mask = 0;
+static uint32_t posted_tick[APP_SCHEDULER_MAX_JOBS];
+static uint32_t allocated_signals = 0;
+static uint32_t run_signal = 0;
+static sl_sleeptimer_timer_handle_t deadline_timer;
+
+static void deadline_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data);
+
+static uint32_t ms_to_ticks(uint32_t ms) {
+    uint32_t ticks = 0;
+    if (sl_sleeptimer_ms32_to_tick(ms, &ticks) != SL_STATUS_OK || ticks == 0) {
+        ticks = 1;
+    }
+    return ticks;
+}
+
+// Must be called with interrupts masked.
+static void make_pending(uint8_t index, uint32_t since) {
+    if (!(pending_mask & (1UL << index))) {
+        pending_mask |= (1UL << index);
+        posted_tick[index] = since;
+    }
+    timed_mask &= ~(1UL << index);
+    if (run_signal != 0) {
+        sl_bt_external_signal(run_signal);
+    }
+}
+
+/**************************************************************************/
+/* Rearm the single timer on the earliest deadline.                       */
+/* Must be called with interrupts masked.                                 */
+/**************************************************************************/
+static void rearm(void) {
+    uint32_t now = sl_sleeptimer_get_tick_count();
+    uint32_t delay = UINT32_MAX;
+
+    sl_sleeptimer_stop_timer(&deadline_timer);
+    if (timed_mask == 0) {
+        return;
+    }
+    for (uint8_t i = 0; i < job_count; i++) {
+        if (timed_mask & (1UL << i)) {
+            int32_t remaining = (int32_t)(jobs[i]->deadline - now);
+            uint32_t d = (remaining > 0) ? (uint32_t)remaining : 1;
+            if (d < delay) {
+                delay = d;
+            }
+        }
+    }
+    sl_sleeptimer_start_timer(&deadline_timer, delay, deadline_timer_callback, NULL, 0, 0);
+}
+
+static void deadline_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    uint32_t now = sl_sleeptimer_get_tick_count();
+
+    for (uint8_t i = 0; i < job_count; i++) {
+        if ((timed_mask & (1UL << i)) && (int32_t)(jobs[i]->deadline - now) <= 0) {
+            // Latency counts from the deadline, not from the post.
+            make_pending(i, jobs[i]->deadline);
+        }
+    }
+    rearm();
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t app_scheduler_init(void) {
+    job_count = 0;
+    pending_mask = 0;
+    timed_mask = 0;
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+    run_signal = app_scheduler_alloc_signal();
+#endif
+    return SL_STATUS_OK;
+}
+
+sl_status_t app_scheduler_add(app_job_t *job, const char *name, uint8_t priority, app_job_handler_t handler) {
+    uint8_t index = job_count;
+
+    if (job_count == APP_SCHEDULER_MAX_JOBS) {
+        LOG_ERROR("No room for job %s.\n", name);
+        return SL_STATUS_FULL;
+    }
+    job->handler = handler;
+    job->name = name;
+    job->priority = priority;
+    job->runs = 0;
+    job->max_latency = 0;
+    // Registration happens at init, before any post, so the masks are
+    // still empty and the order can change freely.
+    while (index > 0 && jobs[index - 1]->priority < priority) {
+        jobs[index] = jobs[index - 1];
+        jobs[index]->index = index;
+        index--;
+    }
+    jobs[index] = job;
+    job->index = index;
+    job_count++;
+    return SL_STATUS_OK;
+}
+
+void app_scheduler_post(app_job_t *job) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    bool was_timed = (timed_mask & (1UL << job->index)) != 0;
+    make_pending(job->index, sl_sleeptimer_get_tick_count());
+    if (was_timed) {
+        rearm();
+    }
+    CORE_EXIT_ATOMIC();
+}
+
+void app_scheduler_post_in(app_job_t *job, uint32_t delay_ms) {
+    CORE_DECLARE_IRQ_STATE;
+    uint32_t deadline = sl_sleeptimer_get_tick_count() + ms_to_ticks(delay_ms);
+
+    CORE_ENTER_ATOMIC();
+    uint32_t bit = 1UL << job->index;
+    if (!(pending_mask & bit)
+        && (!(timed_mask & bit) || (int32_t)(deadline - job->deadline) < 0)) {
+        job->deadline = deadline;
+        timed_mask |= bit;
+        rearm();
+    }
+    CORE_EXIT_ATOMIC();
+}
+
+void app_scheduler_cancel(app_job_t *job) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    uint32_t bit = 1UL << job->index;
+    pending_mask &= ~bit;
+    if (timed_mask & bit) {
+        timed_mask &= ~bit;
+        rearm();
+    }
+    CORE_EXIT_ATOMIC();
+}
+
+void app_scheduler_run(void) {
+    CORE_DECLARE_IRQ_STATE;
+    uint32_t ran = 0;
+
+    for (;;) {
+        CORE_ENTER_ATOMIC();
+        uint32_t ready = pending_mask & ~ran;
+        if (ready == 0) {
+            CORE_EXIT_ATOMIC();
+            break;
+        }
+        // Lowest bit is the highest priority. A job posted by another
+        // one runs in the same call if it ranks higher.
+        uint8_t index = 0;
+        while (!(ready & (1UL << index))) {
+            index++;
+        }
+        pending_mask &= ~(1UL << index);
+        uint32_t latency = sl_sleeptimer_get_tick_count() - posted_tick[index];
+        CORE_EXIT_ATOMIC();
+
+        app_job_t *job = jobs[index];
+        ran |= (1UL << index);
+        if (latency > job->max_latency) {
+            job->max_latency = latency;
+        }
+        job->runs++;
+        job->handler();
+    }
+}
+
+uint32_t app_scheduler_alloc_signal(void) {
+    for (uint32_t bit = 0; bit < 32; bit++) {
+        if (!(allocated_signals & (1UL << bit))) {
+            allocated_signals |= (1UL << bit);
+            return 1UL << bit;
+        }
+    }
+    LOG_ERROR("No external signal bit left.\n");
+    return 0;
+}
+
+uint32_t app_scheduler_signal(void) {
+    return run_signal;
+}
+
+bool app_scheduler_is_ok_to_sleep(void) {
+    return pending_mask == 0;
+}
+
+sl_power_manager_on_isr_exit_t app_scheduler_sleep_on_isr_exit(void) {
+    return (pending_mask != 0) ? SL_POWER_MANAGER_WAKEUP : SL_POWER_MANAGER_IGNORE;
+}
+
+void app_scheduler_log(void) {
+    uint32_t runs[APP_SCHEDULER_MAX_JOBS];
+    uint32_t max_latency[APP_SCHEDULER_MAX_JOBS];
+    uint32_t pending;
+    uint32_t timed;
+    uint8_t count;
+    CORE_DECLARE_IRQ_STATE;
+
+    // Counters and masks only; names and priorities are fixed once added.
+    CORE_ENTER_ATOMIC();
+    count = job_count;
+    pending = pending_mask;
+    timed = timed_mask;
+    for (uint8_t i = 0; i < count; i++) {
+        runs[i] = jobs[i]->runs;
+        max_latency[i] = jobs[i]->max_latency;
+    }
+    CORE_EXIT_ATOMIC();
+
+    LOG_INFO("Scheduler: %u jobs, pending 0x%lX, timed 0x%lX.\n",
+             count,
+             (unsigned long)pending,
+             (unsigned long)timed);
+    for (uint8_t i = 0; i < count; i++) {
+        LOG_INFO("  %-16s prio %u runs %lu max latency %lu ms\n",
+                 jobs[i]->name,
+                 jobs[i]->priority,
+                 (unsigned long)runs[i],
+                 (unsigned long)sl_sleeptimer_tick_to_ms(max_latency[i]));
+    }
+}
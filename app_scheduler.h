@@ -0,0 +1,62 @@
+#ifndef APP_SCHEDULER_H
+#define APP_SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sl_status.h>
+#include "sl_power_manager.h"
+
+// Run-to-completion jobs for deferred application work. A job is posted
+// from any context, now or by a deadline, and runs from the main loop in
+// priority order; all deadlines share one sleeptimer. While a job is
+// pending the MCU is kept awake (see sleep_veto.c). Kernel builds have no
+// main loop and run the jobs from the Bluetooth event task instead, on
+// app_scheduler_signal().
+
+typedef void (*app_job_handler_t)(void);
+
+// Owned by the caller, registered once; fields are private to the scheduler.
+typedef struct {
+    app_job_handler_t handler;
+    const char *name;
+    uint8_t priority;            // higher runs first
+    uint8_t index;               // position in the run order
+    uint32_t deadline;           // absolute sleeptimer tick, while timed
+    uint32_t runs;
+    uint32_t max_latency;        // ticks from post or deadline to run
+} app_job_t;
+
+sl_status_t app_scheduler_init(void);
+
+// Register a job. SL_STATUS_FULL past APP_SCHEDULER_MAX_JOBS.
+sl_status_t app_scheduler_add(app_job_t *job, const char *name, uint8_t priority, app_job_handler_t handler);
+
+// Run the job as soon as possible. Posting a pending job again has no
+// further effect: it runs once.
+void app_scheduler_post(app_job_t *job);
+
+// Run the job within delay_ms. If it is already due earlier, or pending,
+// the earlier time is kept.
+void app_scheduler_post_in(app_job_t *job, uint32_t delay_ms);
+
+// Withdraw a pending or timed job.
+void app_scheduler_cancel(app_job_t *job);
+
+// Run pending jobs, highest priority first, each at most once per call.
+void app_scheduler_run(void);
+
+// Hand out an unused sl_bt_external_signal() bit; 0 when all are taken.
+uint32_t app_scheduler_alloc_signal(void);
+
+// Signal bit that asks the event task to call app_scheduler_run(). Always
+// 0 on bare-metal builds, where app_process_action() runs the jobs.
+uint32_t app_scheduler_signal(void);
+
+// Power manager hooks, called from app_is_ok_to_sleep() and
+// app_sleep_on_isr_exit(): no sleep while a job is pending.
+bool app_scheduler_is_ok_to_sleep(void);
+sl_power_manager_on_isr_exit_t app_scheduler_sleep_on_isr_exit(void);
+
+void app_scheduler_log(void);
+
+#endif // APP_SCHEDULER_H
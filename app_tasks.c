@@ -0,0 +1,153 @@
+#include "sl_component_catalog.h"
+#include "app_tasks.h"
+
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+#include "cmsis_os2.h"
+#include "sl_cmsis_os2_common.h"
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#include "sl_sensor_rht.h"
+#include "sl_sensor_light.h"
+#include "sensor_scheduler.h"
+#include "app_tasks_config.h"
+#define LOG_MODULE APP
+#include "log_module.h"
+
+#define RHT_SENSORS (SENSOR_MASK(SENSOR_ID_TEMPERATURE) | SENSOR_MASK(SENSOR_ID_HUMIDITY))
+#define ALL_SENSORS (RHT_SENSORS | SENSOR_MASK(SENSOR_ID_IRRADIANCE))
+
+static uint32_t result_signal = 0;
+
+static osThreadId_t sensor_thread;
+static osThreadId_t report_thread;
+static osMessageQueueId_t result_queue;
+static osMessageQueueId_t report_queue;
+
+static __ALIGNED(8) uint8_t sensor_stack[APP_TASKS_SENSOR_STACK_SIZE];
+static __ALIGNED(4) uint8_t sensor_cb[osThreadCbSize];
+static __ALIGNED(8) uint8_t report_stack[APP_TASKS_REPORT_STACK_SIZE];
+static __ALIGNED(4) uint8_t report_cb[osThreadCbSize];
+static __ALIGNED(4) uint8_t result_queue_cb[osMessageQueueCbSize];
+static __ALIGNED(4) uint8_t result_queue_mem[APP_TASKS_SENSOR_RESULTS * sizeof(app_tasks_sensor_result_t)];
+static __ALIGNED(4) uint8_t report_queue_cb[osMessageQueueCbSize];
+static __ALIGNED(4) uint8_t report_queue_mem[APP_TASKS_REPORT_QUEUE * sizeof(app_tasks_report_t)];
+
+/**************************************************************************/
+/* Sensor Task                                                            */
+/* Owns the sensor I2C bus, so the light and RHT reads never overlap and  */
+/* may block for as long as the sensors need.                             */
+/**************************************************************************/
+static void sensor_task(void *argument) {
+    (void)argument;
+
+    for (;;) {
+        // Each sensor is a thread flag: requests that arrive while a read
+        // is running are merged into the next one.
+        uint32_t sensors = osThreadFlagsWait(ALL_SENSORS, osFlagsWaitAny, osWaitForever);
+        if (sensors & osFlagsError) {
+            continue;
+        }
+
+        app_tasks_sensor_result_t result = { .sensors = sensors };
+        if (sensors & SENSOR_MASK(SENSOR_ID_IRRADIANCE)) {
+            float uvi;
+            result.light_status = sl_sensor_light_get(&result.lux, &uvi);
+        }
+        if (sensors & RHT_SENSORS) {
+            result.rht.start_tick = sl_sleeptimer_get_tick_count();
+            result.rht.status = sl_sensor_rht_get(&result.rht.rh, &result.rht.temperature);
+            result.rht.done_tick = sl_sleeptimer_get_tick_count();
+        }
+        if (osMessageQueuePut(result_queue, &result, 0, 0) != osOK) {
+            LOG_ERROR("Sensor result queue full, reading lost.\n");
+            continue;
+        }
+        sl_bt_external_signal(result_signal);
+    }
+}
+
+/**************************************************************************/
+/* Report Task                                                            */
+/* Formats the diagnostics reports at the lowest application priority.    */
+/**************************************************************************/
+static void report_task(void *argument) {
+    (void)argument;
+    app_tasks_report_t report;
+
+    for (;;) {
+        if (osMessageQueueGet(report_queue, &report, NULL, osWaitForever) == osOK) {
+            report();
+        }
+    }
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t app_tasks_init(uint32_t signal) {
+    const osMessageQueueAttr_t result_queue_attr = {
+        .name = "sensor results",
+        .cb_mem = result_queue_cb,
+        .cb_size = osMessageQueueCbSize,
+        .mq_mem = result_queue_mem,
+        .mq_size = sizeof(result_queue_mem),
+    };
+    const osMessageQueueAttr_t report_queue_attr = {
+        .name = "reports",
+        .cb_mem = report_queue_cb,
+        .cb_size = osMessageQueueCbSize,
+        .mq_mem = report_queue_mem,
+        .mq_size = sizeof(report_queue_mem),
+    };
+    const osThreadAttr_t sensor_attr = {
+        .name = "sensor",
+        .cb_mem = sensor_cb,
+        .cb_size = osThreadCbSize,
+        .stack_mem = sensor_stack,
+        .stack_size = sizeof(sensor_stack),
+        .priority = (osPriority_t)APP_TASKS_SENSOR_PRIORITY,
+    };
+    const osThreadAttr_t report_attr = {
+        .name = "report",
+        .cb_mem = report_cb,
+        .cb_size = osThreadCbSize,
+        .stack_mem = report_stack,
+        .stack_size = sizeof(report_stack),
+        .priority = (osPriority_t)APP_TASKS_REPORT_PRIORITY,
+    };
+
+    result_signal = signal;
+    result_queue = osMessageQueueNew(APP_TASKS_SENSOR_RESULTS,
+                                     sizeof(app_tasks_sensor_result_t),
+                                     &result_queue_attr);
+    report_queue = osMessageQueueNew(APP_TASKS_REPORT_QUEUE,
+                                     sizeof(app_tasks_report_t),
+                                     &report_queue_attr);
+    sensor_thread = osThreadNew(sensor_task, NULL, &sensor_attr);
+    report_thread = osThreadNew(report_task, NULL, &report_attr);
+    if (result_queue == NULL || report_queue == NULL
+        || sensor_thread == NULL || report_thread == NULL) {
+        LOG_ERROR("Failed to create application tasks.\n");
+        return SL_STATUS_ALLOCATION_FAILED;
+    }
+    return SL_STATUS_OK;
+}
+
+void app_tasks_request_sensors(uint32_t sensors) {
+    if (sensors & ALL_SENSORS) {
+        osThreadFlagsSet(sensor_thread, sensors & ALL_SENSORS);
+    }
+}
+
+bool app_tasks_take_sensor_result(app_tasks_sensor_result_t *out) {
+    return osMessageQueueGet(result_queue, out, NULL, 0) == osOK;
+}
+
+sl_status_t app_tasks_defer_report(app_tasks_report_t report) {
+    if (osMessageQueuePut(report_queue, &report, 0, 0) != osOK) {
+        return SL_STATUS_FULL;
+    }
+    return SL_STATUS_OK;
+}
+
+#endif // SL_CATALOG_KERNEL_PRESENT
@@ -0,0 +1,39 @@
+#ifndef APP_TASKS_H
+#define APP_TASKS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sl_status.h>
+#include "rht_async.h"
+
+// Application tasks of kernel builds (SL_CATALOG_KERNEL_PRESENT). The
+// Bluetooth event task keeps all GATT and connection state; the blocking
+// sensor reads and the diagnostics reports run in tasks of their own so
+// they never hold up event handling.
+
+typedef struct {
+    uint32_t sensors;            // SENSOR_MASK bits acquired
+    sl_status_t light_status;    // sl_sensor_light_get() outcome
+    float lux;
+    rht_async_result_t rht;      // sl_sensor_rht_get() outcome and timing
+} app_tasks_sensor_result_t;
+
+typedef void (*app_tasks_report_t)(void);
+
+// Create the queues and tasks. result_signal is posted through
+// sl_bt_external_signal() whenever a sensor result is queued.
+// Called from app_init(), before the kernel starts.
+sl_status_t app_tasks_init(uint32_t result_signal);
+
+// Ask the sensor task for a reading of the given sensors. Requests made
+// before it gets to them are merged into one acquisition.
+void app_tasks_request_sensors(uint32_t sensors);
+
+// Pop the oldest sensor result; false once the queue is empty.
+bool app_tasks_take_sensor_result(app_tasks_sensor_result_t *out);
+
+// Run a report function in the report task. SL_STATUS_FULL if too many
+// are queued already.
+sl_status_t app_tasks_defer_report(app_tasks_report_t report);
+
+#endif // APP_TASKS_H
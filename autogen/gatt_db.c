@@ -32,12 +32,25 @@ GATT_DATA(const uint16_t gattdb_uuidtable_16_map[]) =
 
 GATT_DATA(const uint8_t gattdb_uuidtable_128_map[]) =
 {
+  0x75, 0x72, 0x93, 0x45, 0x90, 0x35, 0x0f, 0xbd, 0xb7, 0x45, 0x37, 0x0f, 0x01, 0x00, 0xa6, 0x2d, 
+  0x75, 0x72, 0x93, 0x45, 0x90, 0x35, 0x0f, 0xbd, 0xb7, 0x45, 0x37, 0x0f, 0x04, 0x00, 0xa6, 0x2d, 
+  0x75, 0x72, 0x93, 0x45, 0x90, 0x35, 0x0f, 0xbd, 0xb7, 0x45, 0x37, 0x0f, 0x03, 0x00, 0xa6, 0x2d, 
+  0x75, 0x72, 0x93, 0x45, 0x90, 0x35, 0x0f, 0xbd, 0xb7, 0x45, 0x37, 0x0f, 0x05, 0x00, 0xa6, 0x2d, 
+  0x75, 0x72, 0x93, 0x45, 0x90, 0x35, 0x0f, 0xbd, 0xb7, 0x45, 0x37, 0x0f, 0x06, 0x00, 0xa6, 0x2d, 
   0x63, 0x60, 0x32, 0xe0, 0x37, 0x5e, 0xa4, 0x88, 0x53, 0x4e, 0x6d, 0xfb, 0x64, 0x35, 0xbf, 0xf7, 
 };
-GATT_DATA(const sli_bt_gattdb_value_t gattdb_attribute_field_39) = {
+GATT_DATA(const sli_bt_gattdb_value_t gattdb_attribute_field_54) = {
   .len = 16,
   .data = { 0xf0, 0x19, 0x21, 0xb4, 0x47, 0x8f, 0xa4, 0xbf, 0xa1, 0x4f, 0x63, 0xfd, 0xee, 0xd6, 0x14, 0x1d, }
 };
+GATT_DATA(const sli_bt_gattdb_value_t gattdb_attribute_field_46) = {
+  .len = 16,
+  .data = { 0x75, 0x72, 0x93, 0x45, 0x90, 0x35, 0x0f, 0xbd, 0xb7, 0x45, 0x37, 0x0f, 0x02, 0x00, 0xa6, 0x2d, }
+};
+GATT_DATA(const sli_bt_gattdb_value_t gattdb_attribute_field_39) = {
+  .len = 16,
+  .data = { 0x75, 0x72, 0x93, 0x45, 0x90, 0x35, 0x0f, 0xbd, 0xb7, 0x45, 0x37, 0x0f, 0x00, 0x00, 0xa6, 0x2d, }
+};
 GATT_DATA(const sli_bt_gattdb_value_t gattdb_attribute_field_36) = {
   .len = 2,
   .data = { 0x15, 0x18, }
@@ -148,21 +161,36 @@ GATT_DATA(const sli_bt_gattdb_attribute_t gattdb_attributes_map[]) = {
   { .handle = 0x26, .uuid = 0x0002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x05, .characteristic = { .properties = 0x0c, .char_uuid = 0x000e } },
   { .handle = 0x27, .uuid = 0x000e, .permissions = 0x806, .caps = 0xffff, .state = 0x00, .datatype = 0x07, .dynamicdata = NULL },
   { .handle = 0x28, .uuid = 0x0000, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x00, .constdata = &gattdb_attribute_field_39 },
-  { .handle = 0x29, .uuid = 0x0002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x05, .characteristic = { .properties = 0x08, .char_uuid = 0x8000 } },
-  { .handle = 0x2a, .uuid = 0x8000, .permissions = 0x802, .caps = 0xffff, .state = 0x00, .datatype = 0x07, .dynamicdata = NULL },
+  { .handle = 0x29, .uuid = 0x0002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x05, .characteristic = { .properties = 0x10, .char_uuid = 0x8000 } },
+  { .handle = 0x2a, .uuid = 0x8000, .permissions = 0x800, .caps = 0xffff, .state = 0x00, .datatype = 0x07, .dynamicdata = NULL },
+  { .handle = 0x2b, .uuid = 0x0012, .permissions = 0x803, .caps = 0xffff, .state = 0x00, .datatype = 0x03, .configdata = { .flags = 0x01, .clientconfig_index = 0x04 } },
+  { .handle = 0x2c, .uuid = 0x0002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x05, .characteristic = { .properties = 0x18, .char_uuid = 0x8001 } },
+  { .handle = 0x2d, .uuid = 0x8001, .permissions = 0x802, .caps = 0xffff, .state = 0x00, .datatype = 0x07, .dynamicdata = NULL },
+  { .handle = 0x2e, .uuid = 0x0012, .permissions = 0x803, .caps = 0xffff, .state = 0x00, .datatype = 0x03, .configdata = { .flags = 0x01, .clientconfig_index = 0x05 } },
+  { .handle = 0x2f, .uuid = 0x0000, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x00, .constdata = &gattdb_attribute_field_46 },
+  { .handle = 0x30, .uuid = 0x0002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x05, .characteristic = { .properties = 0x12, .char_uuid = 0x8002 } },
+  { .handle = 0x31, .uuid = 0x8002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x07, .dynamicdata = NULL },
+  { .handle = 0x32, .uuid = 0x0012, .permissions = 0x803, .caps = 0xffff, .state = 0x00, .datatype = 0x03, .configdata = { .flags = 0x01, .clientconfig_index = 0x06 } },
+  { .handle = 0x33, .uuid = 0x0002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x05, .characteristic = { .properties = 0x02, .char_uuid = 0x8003 } },
+  { .handle = 0x34, .uuid = 0x8003, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x07, .dynamicdata = NULL },
+  { .handle = 0x35, .uuid = 0x0002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x05, .characteristic = { .properties = 0x0a, .char_uuid = 0x8004 } },
+  { .handle = 0x36, .uuid = 0x8004, .permissions = 0x803, .caps = 0xffff, .state = 0x00, .datatype = 0x07, .dynamicdata = NULL },
+  { .handle = 0x37, .uuid = 0x0000, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x00, .constdata = &gattdb_attribute_field_54 },
+  { .handle = 0x38, .uuid = 0x0002, .permissions = 0x801, .caps = 0xffff, .state = 0x00, .datatype = 0x05, .characteristic = { .properties = 0x08, .char_uuid = 0x8005 } },
+  { .handle = 0x39, .uuid = 0x8005, .permissions = 0x802, .caps = 0xffff, .state = 0x00, .datatype = 0x07, .dynamicdata = NULL },
 };
 
 GATT_HEADER(const sli_bt_gattdb_t gattdb) = {
   .attributes = gattdb_attributes_map,
-  .attribute_table_size = 42,
-  .attribute_num = 42,
+  .attribute_table_size = 57,
+  .attribute_num = 57,
   .uuid16 = gattdb_uuidtable_16_map,
   .uuid16_table_size = 19,
   .uuid16_num = 19,
   .uuid128 = gattdb_uuidtable_128_map,
-  .uuid128_table_size = 1,
-  .uuid128_num = 1,
-  .num_ccfg = 4,
+  .uuid128_table_size = 6,
+  .uuid128_num = 6,
+  .num_ccfg = 7,
   .caps_mask = 0xffff,
   .enabled_caps = 0xffff,
 };
@@ -27,8 +27,15 @@ extern const sli_bt_gattdb_t gattdb;
 #define gattdb_irradiance_0                   35
 #define gattdb_automation_io                  37
 #define gattdb_digital                        39
-#define gattdb_ota                            40
-#define gattdb_ota_control                    42
+#define gattdb_sensor_log                     40
+#define gattdb_batched_samples                42
+#define gattdb_history                        45
+#define gattdb_diagnostics                    47
+#define gattdb_link_diagnostics               49
+#define gattdb_power_diagnostics              52
+#define gattdb_log_levels                     54
+#define gattdb_ota                            55
+#define gattdb_ota_control                    57
 
 
 #endif // __GATT_DB_H
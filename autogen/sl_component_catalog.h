@@ -10,10 +10,13 @@
 #define SL_CATALOG_BLUETOOTH_FEATURE_ADVERTISER_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_BUILTIN_BONDING_DATABASE_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_CONNECTION_PRESENT
+#define SL_CATALOG_BLUETOOTH_FEATURE_EXTENDED_ADVERTISER_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_GATT_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_GATT_SERVER_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_LEGACY_ADVERTISER_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_LEGACY_SCANNER_PRESENT
+#define SL_CATALOG_BLUETOOTH_FEATURE_NVM_PRESENT
+#define SL_CATALOG_BLUETOOTH_FEATURE_PERIODIC_ADVERTISER_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_SCANNER_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_SM_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_SYSTEM_PRESENT
@@ -0,0 +1,210 @@
+#include <stdbool.h>
+#include "em_core.h"
+#include "em_device.h"
+#include "sl_sleeptimer.h"
+#include "sl_power_manager.h"
+#include "binlog.h"
+
+#if BINLOG_ENABLE
+
+#include "dmadrv.h"
+#include "sl_iostream.h"
+#include "sl_iostream_usart_vcom_config.h"
+
+#if SL_IOSTREAM_USART_VCOM_PERIPHERAL_NO != 0
+#error "binlog drives the USART0 TXBL DMA request; update it for the VCOM USART"
+#endif
+
+#define BINLOG_SYNC         0xA5
+#define BINLOG_TEXT_SYNC    0xA6
+#define FRAME_MAX           (1 + 1 + 1 + 4 + 4 * BINLOG_MAX_ARGS + 1)
+#define TEXT_CHUNK_MAX      64
+
+static uint8_t ring[BINLOG_BUFFER_SIZE];
+static uint32_t head = 0;           // next byte written, 0 .. size-1
+static uint32_t tail = 0;           // next byte sent
+static uint32_t used = 0;
+static uint32_t in_flight = 0;      // bytes of the running DMA transfer
+static uint32_t dropped = 0;
+static unsigned int dma_channel;
+static bool em1_held = false;
+static sl_sleeptimer_timer_handle_t drain_timer;
+
+static void start_transfer(void);
+
+static void release_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    if (in_flight == 0 && em1_held) {
+        em1_held = false;
+        sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+    }
+    CORE_EXIT_ATOMIC();
+}
+
+static bool dma_callback(unsigned int channel, unsigned int sequence_no, void *user_param) {
+    (void)channel;
+    (void)sequence_no;
+    (void)user_param;
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    tail = (tail + in_flight) % BINLOG_BUFFER_SIZE;
+    used -= in_flight;
+    in_flight = 0;
+    start_transfer();
+    if (in_flight == 0) {
+        // LDMA is done once the last byte is in the transmit buffer; stay
+        // in EM1 until the USART has shifted it out. Restart: the timer of
+        // an earlier transfer may still run and must not release EM1 early.
+        sl_sleeptimer_restart_timer(&drain_timer, BINLOG_TX_DRAIN_TICKS, release_callback, NULL, 0, 0);
+    }
+    CORE_EXIT_ATOMIC();
+    return true;
+}
+
+// Must be called with interrupts masked.
+static void start_transfer(void) {
+    uint32_t len;
+
+    if (in_flight != 0 || used == 0) {
+        return;
+    }
+    // One contiguous run; the wrapped part follows from the callback.
+    len = (tail + used <= BINLOG_BUFFER_SIZE) ? used : BINLOG_BUFFER_SIZE - tail;
+    if (!em1_held) {
+        em1_held = true;
+        sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+    }
+    in_flight = len;
+    if (DMADRV_MemoryPeripheral(dma_channel,
+                                dmadrvPeripheralSignal_USART0_TXBL,
+                                (void *)&USART0->TXDATA,
+                                &ring[tail],
+                                true,
+                                (int)len,
+                                dmadrvDataSize1,
+                                dma_callback,
+                                NULL) != ECODE_EMDRV_DMADRV_OK) {
+        // Drop what we could not send rather than retrying forever.
+        dropped++;
+        tail = (tail + len) % BINLOG_BUFFER_SIZE;
+        used -= len;
+        in_flight = 0;
+    }
+}
+
+// Copies one whole frame into the ring, so frames never interleave on the
+// port. With wait set the caller spins until LDMA has made room; only
+// thread context with interrupts enabled may wait.
+static void enqueue(const uint8_t *frame, uint32_t len, bool wait) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    while (wait && BINLOG_BUFFER_SIZE - used < len && in_flight != 0) {
+        CORE_EXIT_ATOMIC();
+        CORE_ENTER_ATOMIC();
+    }
+    if (BINLOG_BUFFER_SIZE - used < len) {
+        dropped++;
+    } else {
+        for (uint32_t i = 0; i < len; i++) {
+            ring[head] = frame[i];
+            head = (head + 1) % BINLOG_BUFFER_SIZE;
+        }
+        used += len;
+        start_transfer();
+    }
+    CORE_EXIT_ATOMIC();
+}
+
+/**************************************************************************/
+/* Text stream                                                            */
+/**************************************************************************/
+// app_log and printf write here once binlog_init() has run. Text used to
+// block on the USART, so it still waits for room outside interrupts
+// rather than being dropped.
+static sl_status_t text_write(void *context, const void *buffer, size_t length) {
+    const uint8_t *bytes = buffer;
+    uint8_t frame[1 + 1 + TEXT_CHUNK_MAX + 1];
+    bool wait = !CORE_InIrqContext() && !CORE_IrqIsDisabled();
+    (void)context;
+
+    while (length > 0) {
+        uint32_t chunk = (length > TEXT_CHUNK_MAX) ? TEXT_CHUNK_MAX : (uint32_t)length;
+        uint32_t len = 0;
+        uint8_t check = (uint8_t)chunk;
+
+        frame[len++] = BINLOG_TEXT_SYNC;
+        frame[len++] = (uint8_t)chunk;
+        for (uint32_t i = 0; i < chunk; i++) {
+            frame[len++] = bytes[i];
+            check ^= bytes[i];
+        }
+        frame[len++] = check;
+        enqueue(frame, len, wait);
+        bytes += chunk;
+        length -= chunk;
+    }
+    return SL_STATUS_OK;
+}
+
+static sl_iostream_t text_stream = {
+    .context = NULL,
+    .write = text_write,
+    .read = NULL,
+};
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t binlog_init(void) {
+    Ecode_t ecode = DMADRV_Init();
+
+    if (ecode != ECODE_EMDRV_DMADRV_OK && ecode != ECODE_EMDRV_DMADRV_ALREADY_INITIALIZED) {
+        return SL_STATUS_INITIALIZATION;
+    }
+    if (DMADRV_AllocateChannel(&dma_channel, NULL) != ECODE_EMDRV_DMADRV_OK) {
+        return SL_STATUS_NO_MORE_RESOURCE;
+    }
+    // From here on the DMA owns the USART; text shares its ring.
+    return sl_iostream_set_default_stream(&text_stream);
+}
+
+void binlog_write(binlog_id_t id, const uint32_t *args, uint8_t nargs) {
+    uint8_t frame[FRAME_MAX];
+    uint32_t len = 0;
+    uint32_t tick = sl_sleeptimer_get_tick_count();
+    uint8_t check = 0;
+
+    if (id >= BINLOG_ID_COUNT || nargs > BINLOG_MAX_ARGS) {
+        return;
+    }
+    frame[len++] = BINLOG_SYNC;
+    frame[len++] = (uint8_t)id;
+    frame[len++] = nargs;
+    frame[len++] = tick & 0xFF;
+    frame[len++] = (tick >> 8) & 0xFF;
+    frame[len++] = (tick >> 16) & 0xFF;
+    frame[len++] = (tick >> 24) & 0xFF;
+    for (uint8_t i = 0; i < nargs; i++) {
+        frame[len++] = args[i] & 0xFF;
+        frame[len++] = (args[i] >> 8) & 0xFF;
+        frame[len++] = (args[i] >> 16) & 0xFF;
+        frame[len++] = (args[i] >> 24) & 0xFF;
+    }
+    for (uint32_t i = 1; i < len; i++) {
+        check ^= frame[i];
+    }
+    frame[len++] = check;
+    enqueue(frame, len, false);
+}
+
+uint32_t binlog_dropped(void) {
+    return dropped;
+}
+
+#endif // BINLOG_ENABLE
@@ -0,0 +1,81 @@
+#ifndef BINLOG_H
+#define BINLOG_H
+
+#include <stdint.h>
+#include <sl_status.h>
+#include "log_module.h"
+#include "binlog_formats.h"
+#include "binlog_config.h"
+
+/**************************************************************************/
+/* Deferred-format binary log.                                            */
+/*                                                                        */
+/* A call copies a frame into a RAM ring and returns; LDMA drains the     */
+/* ring to the VCOM USART in the background. Frame layout:                */
+/*   uint8  0xA5 sync                                                     */
+/*   uint8  format ID (position in BINLOG_FORMATS)                        */
+/*   uint8  argument count                                                */
+/*   uint32 sleeptimer tick                                               */
+/*   uint32 arguments                                                     */
+/*   uint8  XOR of all bytes after the sync byte                          */
+/* Multi-byte fields are little-endian. binlog_init() also makes the ring */
+/* the default iostream, so app_log text reaches the port as frames of    */
+/*   uint8  0xA6 sync                                                     */
+/*   uint8  length                                                        */
+/*   length bytes of text                                                 */
+/*   uint8  XOR of all bytes after the sync byte                          */
+/* and never splits a binary frame. Text written before binlog_init()     */
+/* goes out raw; the decoder passes it through.                           */
+/* BINLOG_INFO() is filtered like LOG_INFO() for the caller's LOG_MODULE. */
+/* Its arguments are converted to uint32_t at the call site, and a count  */
+/* that differs from the format table fails to compile.                   */
+/**************************************************************************/
+
+#define BINLOG_MAX_ARGS 3
+
+#define BINLOG_ID(name, nargs) BINLOG_ID_##name,
+typedef enum {
+    BINLOG_FORMATS(BINLOG_ID)
+    BINLOG_ID_COUNT
+} binlog_id_t;
+#undef BINLOG_ID
+
+#define BINLOG_COUNT(name, nargs) BINLOG_NARGS_##name = nargs,
+enum {
+    BINLOG_FORMATS(BINLOG_COUNT)
+};
+#undef BINLOG_COUNT
+
+#define BINLOG_ARGS(...)  ((const uint32_t[]){ __VA_ARGS__ })
+
+// Negative array size, so a compile error, unless the call passes as many
+// arguments as the table lists for name.
+#define BINLOG_CHECK_NARGS(name, ...) \
+    ((void)sizeof(char[(sizeof(BINLOG_ARGS(__VA_ARGS__)) / sizeof(uint32_t) == BINLOG_NARGS_##name) ? 1 : -1]))
+
+#if BINLOG_ENABLE
+
+sl_status_t binlog_init(void);
+void binlog_write(binlog_id_t id, const uint32_t *args, uint8_t nargs);
+uint32_t binlog_dropped(void);
+
+#define BINLOG_INFO(name, ...)                                                      \
+    do {                                                                            \
+        BINLOG_CHECK_NARGS(name, __VA_ARGS__);                                      \
+        if (LOG_ON(APP_LOG_LEVEL_INFO)) {                                           \
+            binlog_write(BINLOG_ID_##name, BINLOG_ARGS(__VA_ARGS__), BINLOG_NARGS_##name); \
+        }                                                                           \
+    } while (0)
+
+#else
+
+#define binlog_init()           ((void)0)
+#define BINLOG_INFO(name, ...)                                                      \
+    do {                                                                            \
+        BINLOG_CHECK_NARGS(name, __VA_ARGS__);                                      \
+        LOG_INFO(BINLOG_FORMAT_##name, __VA_ARGS__);                                \
+    } while (0)
+
+#endif // BINLOG_ENABLE
+
+#endif // BINLOG_H
@@ -0,0 +1,19 @@
+#ifndef BINLOG_FORMATS_H
+#define BINLOG_FORMATS_H
+
+// Format table of the binary log: X(name, argument count). The text of
+// each entry is BINLOG_FORMAT_<name>; only the BINLOG_ENABLE=0 build
+// prints it, binary builds keep it out of flash altogether.
+// Frames carry the position in this table, so entries are only ever
+// appended; the host decoder reads this file to restore the text.
+// Each entry takes 1 to BINLOG_MAX_ARGS arguments, sent as uint32_t.
+#define BINLOG_FORMAT_IRRADIANCE_SENT   "Irradiance notification sent: %u (0.1 W/m2).\n"
+#define BINLOG_FORMAT_TEMPERATURE_SENT  "Temperature notification sent: %d (0.01 C).\n"
+#define BINLOG_FORMAT_HUMIDITY_SENT     "Humidity notification sent: %u (0.01 %%).\n"
+
+#define BINLOG_FORMATS(X)                                                   \
+    X(IRRADIANCE_SENT,       1)                                             \
+    X(TEMPERATURE_SENT,      1)                                             \
+    X(HUMIDITY_SENT,         1)
+
+#endif // BINLOG_FORMATS_H
@@ -0,0 +1,110 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include "sl_bluetooth.h"
+#define LOG_MODULE LINK
+#include "log_module.h"
+#include "gatt_db.h"
+#include "broadcast.h"
+
+#define AD_TYPE_FLAGS                 0x01
+#define AD_TYPE_COMPLETE_LOCAL_NAME   0x09
+#define AD_TYPE_SERVICE_DATA_16       0x16
+#define AD_FLAGS_LE_GENERAL_BR_EDR_NS 0x06
+#define ESS_SERVICE_UUID              0x181A
+#define LEGACY_ADV_MAX_LEN            31
+
+#define SERVICE_DATA_LEN              (1 + 2 * SENSOR_ID_COUNT)
+
+static uint8_t advertising_handle = 0xff;
+static uint8_t sequence = 0;
+static bool dirty = false;
+static uint16_t readings[SENSOR_ID_COUNT] = { 0x8000, 0xFFFF, 0xFFFF };
+
+/**************************************************************************/
+/* Payload Encoding                                                       */
+/**************************************************************************/
+static size_t encode_advertising_data(uint8_t *buf) {
+    size_t len = 0;
+
+    buf[len++] = 2;
+    buf[len++] = AD_TYPE_FLAGS;
+    buf[len++] = AD_FLAGS_LE_GENERAL_BR_EDR_NS;
+
+    buf[len++] = 1 + 2 + SERVICE_DATA_LEN;
+    buf[len++] = AD_TYPE_SERVICE_DATA_16;
+    buf[len++] = ESS_SERVICE_UUID & 0xFF;
+    buf[len++] = (ESS_SERVICE_UUID >> 8) & 0xFF;
+    buf[len++] = sequence;
+    for (int id = 0; id < SENSOR_ID_COUNT; id++) {
+        buf[len++] = readings[id] & 0xFF;
+        buf[len++] = (readings[id] >> 8) & 0xFF;
+    }
+    return len;
+}
+
+static size_t encode_scan_response(uint8_t *buf) {
+    size_t name_len = 0;
+
+    // Advertise the current Device Name, which clients may rewrite.
+    if (sl_bt_gatt_server_read_attribute_value(gattdb_device_name, 0,
+                                               LEGACY_ADV_MAX_LEN - 2,
+                                               &name_len, &buf[2]) != SL_STATUS_OK) {
+        return 0;
+    }
+    buf[0] = (uint8_t)(name_len + 1);
+    buf[1] = AD_TYPE_COMPLETE_LOCAL_NAME;
+    return name_len + 2;
+}
+
+static sl_status_t write_advertising_data(void) {
+    uint8_t buf[LEGACY_ADV_MAX_LEN];
+    size_t len = encode_advertising_data(buf);
+
+    return sl_bt_legacy_advertiser_set_data(advertising_handle,
+                                            sl_bt_advertiser_advertising_data_packet,
+                                            len, buf);
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t broadcast_init(uint8_t advertising_set) {
+    uint8_t buf[LEGACY_ADV_MAX_LEN];
+    size_t len;
+
+    advertising_handle = advertising_set;
+    sl_status_t sc = write_advertising_data();
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to set advertising data: 0x%lX\n", sc);
+        return sc;
+    }
+    len = encode_scan_response(buf);
+    sc = sl_bt_legacy_advertiser_set_data(advertising_handle,
+                                          sl_bt_advertiser_scan_response_packet,
+                                          len, buf);
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to set scan response data: 0x%lX\n", sc);
+    }
+    return sc;
+}
+
+void broadcast_set_reading(sensor_id_t sensor, uint16_t value) {
+    if (sensor >= SENSOR_ID_COUNT || readings[sensor] == value) {
+        return;
+    }
+    readings[sensor] = value;
+    dirty = true;
+}
+
+sl_status_t broadcast_refresh(void) {
+    if (!dirty || advertising_handle == 0xff) {
+        return SL_STATUS_OK;
+    }
+    dirty = false;
+    sequence++;
+    sl_status_t sc = write_advertising_data();
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to refresh advertising data: 0x%lX\n", sc);
+    }
+    return sc;
+}
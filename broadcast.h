@@ -0,0 +1,26 @@
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#include <stdint.h>
+#include <sl_status.h>
+#include "sensor_scheduler.h"
+
+// Advertising payload: Flags, then Environmental Sensing (0x181A) service
+// data carrying (little-endian)
+//   uint8  sequence      incremented whenever a reading changes
+//   sint16 temperature   0.01 degC, 0x8000 if not known yet
+//   uint16 humidity      0.01 %,    0xFFFF if not known yet
+//   uint16 irradiance    0.1 W/m2,  0xFFFF if not known yet
+// The scan response holds the complete local name.
+
+// Write the initial payload into an advertising set created by the caller.
+sl_status_t broadcast_init(uint8_t advertising_set);
+
+// Record the latest reading of a sensor, in its characteristic's format.
+void broadcast_set_reading(sensor_id_t sensor, uint16_t value);
+
+// Push the payload to the advertiser if any reading changed since the last
+// call. Batches the readings of one sampling round into one update.
+sl_status_t broadcast_refresh(void);
+
+#endif // BROADCAST_H
@@ -0,0 +1,84 @@
+#include <stdbool.h>
+#include "sl_component_catalog.h"
+#include "em_core.h"
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#include "bt_drain.h"
+#include "bt_drain_config.h"
+#define LOG_MODULE DIAGNOSTICS
+#include "log_module.h"
+
+static bt_drain_stats_t stats;
+#if BT_DRAIN_ENABLE && !defined(SL_CATALOG_KERNEL_PRESENT)
+static uint32_t budget_ticks = 0;
+#endif
+
+void bt_drain_process(void) {
+// Kernel builds have no super loop: the RTOS adaptation's event task
+// drains the queue, and sl_bt_can_process_event() does not exist.
+#if BT_DRAIN_ENABLE && !defined(SL_CATALOG_KERNEL_PRESENT)
+    sl_bt_msg_t evt;
+    uint32_t start;
+    uint32_t events = 0;
+    uint32_t bytes = 0;
+
+    if (budget_ticks == 0) {
+        uint64_t ticks = ((uint64_t)BT_DRAIN_BUDGET_US * sl_sleeptimer_get_timer_frequency()) / 1000000;
+        budget_ticks = (ticks > 0) ? (uint32_t)ticks : 1;
+    }
+    start = sl_sleeptimer_get_tick_count();
+    while (events < BT_DRAIN_MAX_EVENTS) {
+        if (events > 0 && (sl_sleeptimer_get_tick_count() - start) >= budget_ticks) {
+            stats.budget_hits++;
+            break;
+        }
+        // Same sequence as sl_bt_step(): let the stack run, then pop only
+        // what the application can take right now.
+        sl_bt_run();
+        uint32_t len = sl_bt_event_pending_len();
+        if (len == 0 || !sl_bt_can_process_event(len)) {
+            break;
+        }
+        if (sl_bt_pop_event(&evt) != SL_STATUS_OK) {
+            break;
+        }
+        sl_bt_process_event(&evt);
+        events++;
+        bytes += len;
+    }
+    if (events == BT_DRAIN_MAX_EVENTS) {
+        stats.limit_hits++;
+    }
+    if (events > 0) {
+        stats.batches++;
+        stats.events += events;
+        if (events > stats.max_events) {
+            stats.max_events = events;
+        }
+        if (bytes > stats.max_bytes) {
+            stats.max_bytes = bytes;
+        }
+    }
+#endif
+}
+
+void bt_drain_get_stats(bt_drain_stats_t *out) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    *out = stats;
+    CORE_EXIT_ATOMIC();
+}
+
+void bt_drain_log(void) {
+    bt_drain_stats_t snapshot;
+
+    bt_drain_get_stats(&snapshot);
+    LOG_INFO("BT drain: %lu batches, %lu events, max %lu events / %lu bytes, limit %lu, budget %lu.\n",
+             (unsigned long)snapshot.batches,
+             (unsigned long)snapshot.events,
+             (unsigned long)snapshot.max_events,
+             (unsigned long)snapshot.max_bytes,
+             (unsigned long)snapshot.limit_hits,
+             (unsigned long)snapshot.budget_hits);
+}
@@ -0,0 +1,25 @@
+#ifndef BT_DRAIN_H
+#define BT_DRAIN_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint32_t batches;            // calls that found at least one event
+    uint32_t events;             // events handled by those calls
+    uint32_t max_events;         // high-water mark of events in one batch
+    uint32_t max_bytes;          // high-water mark of event bytes in one batch
+    uint32_t limit_hits;         // batches stopped by BT_DRAIN_MAX_EVENTS
+    uint32_t budget_hits;        // batches stopped by BT_DRAIN_BUDGET_US
+} bt_drain_stats_t;
+
+// Pop and dispatch events still queued after sl_bt_step(), up to
+// BT_DRAIN_MAX_EVENTS or BT_DRAIN_BUDGET_US. Called from the super loop;
+// a no-op when BT_DRAIN_ENABLE is 0 and on kernel builds.
+void bt_drain_process(void);
+
+// The byte high-water mark counts queued events that were waiting at
+// once, a lower bound for the event share of SL_BT_CONFIG_BUFFER_SIZE.
+void bt_drain_get_stats(bt_drain_stats_t *out);
+void bt_drain_log(void);
+
+#endif // BT_DRAIN_H
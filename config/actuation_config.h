@@ -0,0 +1,101 @@
+/***************************************************************************//**
+ * @file
+ * @brief Digital characteristic actuation configuration.
+ ******************************************************************************/
+
+#ifndef ACTUATION_CONFIG_H
+#define ACTUATION_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Pattern of a signal written as 0b10
+
+// <o ACTUATION_PATTERN_ON_MS> On time [ms] <10-10000>
+// <i> Default: 100
+#define ACTUATION_PATTERN_ON_MS            100
+
+// <o ACTUATION_PATTERN_OFF_MS> Off time [ms] <10-10000>
+// <i> Default: 400
+#define ACTUATION_PATTERN_OFF_MS           400
+
+// <o ACTUATION_PATTERN_COUNT> Repetitions <0-255>
+// <i> Number of on/off cycles before the signal returns to its steady
+// <i> state; 1 gives a single pulse, 0 repeats until the next write.
+// <i> Default: 10
+#define ACTUATION_PATTERN_COUNT            10
+
+// </h>
+
+// <h> GPIO signals
+
+// <o ACTUATION_GPIO_COUNT> GPIO outputs <0-4>
+// <i> Digital signals after the simple LEDs drive these pins, signal
+// <i> SL_SIMPLE_LED_COUNT being GPIO0. Set the pins below for the board.
+// <i> Default: 0
+#define ACTUATION_GPIO_COUNT               0
+
+// <q ACTUATION_GPIO0_ACTIVE_LOW> GPIO0 active low
+// <i> Default: 0
+#define ACTUATION_GPIO0_ACTIVE_LOW         0
+
+// <q ACTUATION_GPIO1_ACTIVE_LOW> GPIO1 active low
+// <i> Default: 0
+#define ACTUATION_GPIO1_ACTIVE_LOW         0
+
+// <q ACTUATION_GPIO2_ACTIVE_LOW> GPIO2 active low
+// <i> Default: 0
+#define ACTUATION_GPIO2_ACTIVE_LOW         0
+
+// <q ACTUATION_GPIO3_ACTIVE_LOW> GPIO3 active low
+// <i> Default: 0
+#define ACTUATION_GPIO3_ACTIVE_LOW         0
+
+// </h>
+
+// <<< end of configuration section >>>
+
+// <<< sl:start pin_tool >>>
+
+// <gpio> ACTUATION_GPIO0
+// $[GPIO_ACTUATION_GPIO0]
+#ifndef ACTUATION_GPIO0_PORT
+#define ACTUATION_GPIO0_PORT                 gpioPortC
+#endif
+#ifndef ACTUATION_GPIO0_PIN
+#define ACTUATION_GPIO0_PIN                  6
+#endif
+// [GPIO_ACTUATION_GPIO0]$
+
+// <gpio> ACTUATION_GPIO1
+// $[GPIO_ACTUATION_GPIO1]
+#ifndef ACTUATION_GPIO1_PORT
+#define ACTUATION_GPIO1_PORT                 gpioPortC
+#endif
+#ifndef ACTUATION_GPIO1_PIN
+#define ACTUATION_GPIO1_PIN                  7
+#endif
+// [GPIO_ACTUATION_GPIO1]$
+
+// <gpio> ACTUATION_GPIO2
+// $[GPIO_ACTUATION_GPIO2]
+#ifndef ACTUATION_GPIO2_PORT
+#define ACTUATION_GPIO2_PORT                 gpioPortC
+#endif
+#ifndef ACTUATION_GPIO2_PIN
+#define ACTUATION_GPIO2_PIN                  8
+#endif
+// [GPIO_ACTUATION_GPIO2]$
+
+// <gpio> ACTUATION_GPIO3
+// $[GPIO_ACTUATION_GPIO3]
+#ifndef ACTUATION_GPIO3_PORT
+#define ACTUATION_GPIO3_PORT                 gpioPortC
+#endif
+#ifndef ACTUATION_GPIO3_PIN
+#define ACTUATION_GPIO3_PIN                  9
+#endif
+// [GPIO_ACTUATION_GPIO3]$
+
+// <<< sl:end pin_tool >>>
+
+#endif // ACTUATION_CONFIG_H
@@ -0,0 +1,17 @@
+/***************************************************************************//**
+ * @file
+ * @brief Cooperative job scheduler configuration.
+ ******************************************************************************/
+
+#ifndef APP_SCHEDULER_CONFIG_H
+#define APP_SCHEDULER_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <o APP_SCHEDULER_MAX_JOBS> Maximum number of jobs <1-32>
+// <i> Default: 16
+#define APP_SCHEDULER_MAX_JOBS             16
+
+// <<< end of configuration section >>>
+
+#endif // APP_SCHEDULER_CONFIG_H
@@ -0,0 +1,52 @@
+/***************************************************************************//**
+ * @file
+ * @brief Application task configuration for kernel builds.
+ *
+ * Only used when a kernel component (FreeRTOS or Micrium OS) is added to
+ * the project, which defines SL_CATALOG_KERNEL_PRESENT. The Bluetooth RTOS
+ * adaptation then runs the link layer, host stack and event handler tasks
+ * at SL_BT_RTOS_*_TASK_PRIORITY (52, 51 and 50 by default); the tasks below
+ * must stay under all three.
+ ******************************************************************************/
+
+#ifndef APP_TASKS_CONFIG_H
+#define APP_TASKS_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Sensor task
+
+// <o APP_TASKS_SENSOR_PRIORITY> Priority (CMSIS-RTOS2) <1-49>
+// <i> Default: 24 (osPriorityNormal)
+#define APP_TASKS_SENSOR_PRIORITY          24
+
+// <o APP_TASKS_SENSOR_STACK_SIZE> Stack size [bytes] <512-8192:8>
+// <i> Default: 1024
+#define APP_TASKS_SENSOR_STACK_SIZE        1024
+
+// <o APP_TASKS_SENSOR_RESULTS> Result queue depth <1-16>
+// <i> Results waiting for the Bluetooth event task.
+// <i> Default: 4
+#define APP_TASKS_SENSOR_RESULTS           4
+
+// </h>
+
+// <h> Report task
+
+// <o APP_TASKS_REPORT_PRIORITY> Priority (CMSIS-RTOS2) <1-49>
+// <i> Default: 8 (osPriorityLow)
+#define APP_TASKS_REPORT_PRIORITY          8
+
+// <o APP_TASKS_REPORT_STACK_SIZE> Stack size [bytes] <512-8192:8>
+// <i> Default: 1536
+#define APP_TASKS_REPORT_STACK_SIZE        1536
+
+// <o APP_TASKS_REPORT_QUEUE> Request queue depth <1-16>
+// <i> Default: 4
+#define APP_TASKS_REPORT_QUEUE             4
+
+// </h>
+
+// <<< end of configuration section >>>
+
+#endif // APP_TASKS_CONFIG_H
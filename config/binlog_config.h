@@ -0,0 +1,34 @@
+/***************************************************************************//**
+ * @file
+ * @brief Binary log configuration.
+ ******************************************************************************/
+
+#ifndef BINLOG_CONFIG_H
+#define BINLOG_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q BINLOG_ENABLE> Binary logging on the sample path
+// <i> BINLOG_INFO() stores the format ID and raw arguments in RAM and
+// <i> drains them to VCOM with LDMA. app_log text is framed into the
+// <i> same ring so the two never interleave; tools/binlog_decode.py
+// <i> restores both. When disabled it prints the same text through
+// <i> app_log_info().
+// <i> Default: 0
+#define BINLOG_ENABLE                      0
+
+// <o BINLOG_BUFFER_SIZE> Ring buffer size [bytes] <64-2048>
+// <i> Binary frames that do not fit are dropped and counted; text
+// <i> written outside interrupts waits for room instead.
+// <i> Default: 512
+#define BINLOG_BUFFER_SIZE                 512
+
+// <o BINLOG_TX_DRAIN_TICKS> Transmitter drain time [sleeptimer ticks] <1-100>
+// <i> EM1 is held this long after the last DMA write so the USART can
+// <i> shift out its last bytes before the clock stops.
+// <i> Default: 8
+#define BINLOG_TX_DRAIN_TICKS              8
+
+// <<< end of configuration section >>>
+
+#endif // BINLOG_CONFIG_H
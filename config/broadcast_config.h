@@ -0,0 +1,25 @@
+/***************************************************************************//**
+ * @file
+ * @brief Connectionless sensor broadcast configuration.
+ ******************************************************************************/
+
+#ifndef BROADCAST_CONFIG_H
+#define BROADCAST_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q BROADCAST_ENABLE> Broadcast readings in the advertising payload
+// <i> Sensors are sampled continuously and the latest readings are placed
+// <i> in Environmental Sensing service data, so a scanner can collect them
+// <i> without connecting.
+// <i> Default: 0
+#define BROADCAST_ENABLE                   0
+
+// <q BROADCAST_CONNECTABLE> Keep accepting connections while broadcasting
+// <i> When disabled the device is a pure beacon: scannable, not connectable.
+// <i> Default: 1
+#define BROADCAST_CONNECTABLE              1
+
+// <<< end of configuration section >>>
+
+#endif // BROADCAST_CONFIG_H
@@ -0,0 +1,28 @@
+/***************************************************************************//**
+ * @file
+ * @brief Bluetooth event batch drain configuration.
+ ******************************************************************************/
+
+#ifndef BT_DRAIN_CONFIG_H
+#define BT_DRAIN_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q BT_DRAIN_ENABLE> Drain pending events in batches
+// <i> After the super loop's own sl_bt_step(), keep popping events in
+// <i> the same iteration instead of one per loop pass.
+// <i> Default: 1
+#define BT_DRAIN_ENABLE                    1
+
+// <o BT_DRAIN_MAX_EVENTS> Events per batch <1-64>
+// <i> Default: 8
+#define BT_DRAIN_MAX_EVENTS                8
+
+// <o BT_DRAIN_BUDGET_US> Time budget per batch [us] <100-100000>
+// <i> No further event is popped once a batch has run this long.
+// <i> Default: 2000
+#define BT_DRAIN_BUDGET_US                 2000
+
+// <<< end of configuration section >>>
+
+#endif // BT_DRAIN_CONFIG_H
@@ -0,0 +1,63 @@
+/***************************************************************************//**
+ * @file
+ * @brief Adaptive connection parameter configuration.
+ ******************************************************************************/
+
+#ifndef CONNECTION_PARAMS_CONFIG_H
+#define CONNECTION_PARAMS_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Burst profile
+// <i> Requested while a batched upload or OTA transfer is in progress.
+
+// <o CONNECTION_PARAMS_BURST_MIN_INTERVAL> Minimum interval [1.25 ms] <6-3200>
+// <i> Default: 12 (15 ms)
+#define CONNECTION_PARAMS_BURST_MIN_INTERVAL     12
+
+// <o CONNECTION_PARAMS_BURST_MAX_INTERVAL> Maximum interval [1.25 ms] <6-3200>
+// <i> Default: 24 (30 ms)
+#define CONNECTION_PARAMS_BURST_MAX_INTERVAL     24
+
+// <o CONNECTION_PARAMS_BURST_LATENCY> Peripheral latency [events] <0-499>
+// <i> Default: 0
+#define CONNECTION_PARAMS_BURST_LATENCY          0
+
+// <o CONNECTION_PARAMS_BURST_TIMEOUT> Supervision timeout [10 ms] <10-3200>
+// <i> Default: 400 (4 s)
+#define CONNECTION_PARAMS_BURST_TIMEOUT          400
+
+// </h>
+
+// <h> Idle profile
+// <i> Requested once no burst was seen for the hold time. Latency lets the
+// <i> radio skip events with nothing to send; queued notifications still go
+// <i> out at the next connection event.
+
+// <o CONNECTION_PARAMS_IDLE_MIN_INTERVAL> Minimum interval [1.25 ms] <6-3200>
+// <i> Default: 320 (400 ms)
+#define CONNECTION_PARAMS_IDLE_MIN_INTERVAL      320
+
+// <o CONNECTION_PARAMS_IDLE_MAX_INTERVAL> Maximum interval [1.25 ms] <6-3200>
+// <i> Default: 400 (500 ms)
+#define CONNECTION_PARAMS_IDLE_MAX_INTERVAL      400
+
+// <o CONNECTION_PARAMS_IDLE_LATENCY> Peripheral latency [events] <0-499>
+// <i> Default: 4
+#define CONNECTION_PARAMS_IDLE_LATENCY           4
+
+// <o CONNECTION_PARAMS_IDLE_TIMEOUT> Supervision timeout [10 ms] <10-3200>
+// <i> Must exceed 2 * (1 + latency) * max interval.
+// <i> Default: 600 (6 s)
+#define CONNECTION_PARAMS_IDLE_TIMEOUT           600
+
+// </h>
+
+// <o CONNECTION_PARAMS_BURST_HOLD_MS> Burst hold time [ms] <100-60000>
+// <i> The burst profile is kept this long after the last burst traffic.
+// <i> Default: 2000
+#define CONNECTION_PARAMS_BURST_HOLD_MS          2000
+
+// <<< end of configuration section >>>
+
+#endif // CONNECTION_PARAMS_CONFIG_H
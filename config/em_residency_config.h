@@ -0,0 +1,18 @@
+/***************************************************************************//**
+ * @file
+ * @brief Energy mode residency accounting configuration.
+ ******************************************************************************/
+
+#ifndef EM_RESIDENCY_CONFIG_H
+#define EM_RESIDENCY_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <o EM_RESIDENCY_LOG_PERIOD_S> Log period [s] <0-86400>
+// <i> Residency is logged this often; 0 only exposes it over GATT.
+// <i> Default: 300
+#define EM_RESIDENCY_LOG_PERIOD_S          300
+
+// <<< end of configuration section >>>
+
+#endif // EM_RESIDENCY_CONFIG_H
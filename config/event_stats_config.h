@@ -0,0 +1,23 @@
+/***************************************************************************//**
+ * @file
+ * @brief Bluetooth event handling statistics configuration.
+ ******************************************************************************/
+
+#ifndef EVENT_STATS_CONFIG_H
+#define EVENT_STATS_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q EVENT_STATS_ENABLE> Measure sl_bt_on_event handling time
+// <i> Counts events per type and their handling time with the DWT cycle
+// <i> counter, and logs a report periodically.
+// <i> Default: 0
+#define EVENT_STATS_ENABLE                 0
+
+// <o EVENT_STATS_REPORT_PERIOD_S> Report period [s] <1-3600>
+// <i> Default: 60
+#define EVENT_STATS_REPORT_PERIOD_S        60
+
+// <<< end of configuration section >>>
+
+#endif // EVENT_STATS_CONFIG_H
@@ -0,0 +1,46 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sample history log configuration.
+ ******************************************************************************/
+
+#ifndef HISTORY_LOG_CONFIG_H
+#define HISTORY_LOG_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q HISTORY_LOG_ENABLE> Log every sample to the external SPI flash
+// <i> Sensors are sampled continuously and each sample is appended to a
+// <i> circular log that gateways can download through the History
+// <i> characteristic after being offline.
+// <i> Default: 0
+#define HISTORY_LOG_ENABLE                 0
+
+// <o HISTORY_LOG_REGION_START> Log region start address <0x0-0xFFF000:0x1000>
+// <i> Must be sector (4 KiB) aligned.
+// <i> Default: 0x0
+#define HISTORY_LOG_REGION_START           0x0
+
+// <o HISTORY_LOG_REGION_SIZE> Log region size [bytes] <0x0-0x1000000:0x1000>
+// <i> 0 uses the flash from the start address to its end. At least two
+// <i> sectors are needed since one is always kept erased ahead.
+// <i> Default: 0
+#define HISTORY_LOG_REGION_SIZE            0x0
+
+// <o HISTORY_LOG_NOTIFICATIONS_PER_PASS> Notifications per event loop pass <1-32>
+// <i> A download yields to the event loop after this many notifications.
+// <i> Default: 4
+#define HISTORY_LOG_NOTIFICATIONS_PER_PASS 4
+
+// <o HISTORY_LOG_RETRY_MS> Retry delay when the stack is out of buffers [ms] <1-1000>
+// <i> Default: 15
+#define HISTORY_LOG_RETRY_MS               15
+
+// <o HISTORY_LOG_ERASE_POLL_MS> Sector erase poll interval [ms] <1-500>
+// <i> The flash is checked this often while erasing and put back into
+// <i> deep power-down when the erase has completed.
+// <i> Default: 10
+#define HISTORY_LOG_ERASE_POLL_MS          10
+
+// <<< end of configuration section >>>
+
+#endif // HISTORY_LOG_CONFIG_H
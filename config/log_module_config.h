@@ -0,0 +1,70 @@
+/***************************************************************************//**
+ * @file
+ * @brief Per-module log level configuration.
+ ******************************************************************************/
+
+#ifndef LOG_MODULE_CONFIG_H
+#define LOG_MODULE_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Build thresholds
+// <i> Messages below a module's threshold are compiled out, format string
+// <i> and argument evaluation included. The runtime level can only be
+// <i> raised above this threshold.
+
+// <o LOG_MODULE_APP_LEVEL> Application
+// <APP_LOG_LEVEL_DEBUG=> DEBUG
+// <APP_LOG_LEVEL_INFO=> INFO
+// <APP_LOG_LEVEL_WARNING=> WARNING
+// <APP_LOG_LEVEL_ERROR=> ERROR
+// <APP_LOG_LEVEL_CRITICAL=> CRITICAL
+// <LOG_LEVEL_OFF=> OFF
+// <i> Default: APP_LOG_LEVEL_INFO
+#define LOG_MODULE_APP_LEVEL               APP_LOG_LEVEL_INFO
+
+// <o LOG_MODULE_SENSOR_LEVEL> Sensor value encoding
+// <APP_LOG_LEVEL_DEBUG=> DEBUG
+// <APP_LOG_LEVEL_INFO=> INFO
+// <APP_LOG_LEVEL_WARNING=> WARNING
+// <APP_LOG_LEVEL_ERROR=> ERROR
+// <APP_LOG_LEVEL_CRITICAL=> CRITICAL
+// <LOG_LEVEL_OFF=> OFF
+// <i> Default: APP_LOG_LEVEL_INFO
+#define LOG_MODULE_SENSOR_LEVEL            APP_LOG_LEVEL_INFO
+
+// <o LOG_MODULE_LINK_LEVEL> Connections and advertising
+// <APP_LOG_LEVEL_DEBUG=> DEBUG
+// <APP_LOG_LEVEL_INFO=> INFO
+// <APP_LOG_LEVEL_WARNING=> WARNING
+// <APP_LOG_LEVEL_ERROR=> ERROR
+// <APP_LOG_LEVEL_CRITICAL=> CRITICAL
+// <LOG_LEVEL_OFF=> OFF
+// <i> Default: APP_LOG_LEVEL_INFO
+#define LOG_MODULE_LINK_LEVEL              APP_LOG_LEVEL_INFO
+
+// <o LOG_MODULE_HISTORY_LEVEL> History log
+// <APP_LOG_LEVEL_DEBUG=> DEBUG
+// <APP_LOG_LEVEL_INFO=> INFO
+// <APP_LOG_LEVEL_WARNING=> WARNING
+// <APP_LOG_LEVEL_ERROR=> ERROR
+// <APP_LOG_LEVEL_CRITICAL=> CRITICAL
+// <LOG_LEVEL_OFF=> OFF
+// <i> Default: APP_LOG_LEVEL_INFO
+#define LOG_MODULE_HISTORY_LEVEL           APP_LOG_LEVEL_INFO
+
+// <o LOG_MODULE_DIAGNOSTICS_LEVEL> Diagnostics reports
+// <APP_LOG_LEVEL_DEBUG=> DEBUG
+// <APP_LOG_LEVEL_INFO=> INFO
+// <APP_LOG_LEVEL_WARNING=> WARNING
+// <APP_LOG_LEVEL_ERROR=> ERROR
+// <APP_LOG_LEVEL_CRITICAL=> CRITICAL
+// <LOG_LEVEL_OFF=> OFF
+// <i> Default: APP_LOG_LEVEL_INFO
+#define LOG_MODULE_DIAGNOSTICS_LEVEL       APP_LOG_LEVEL_INFO
+
+// </h>
+
+// <<< end of configuration section >>>
+
+#endif // LOG_MODULE_CONFIG_H
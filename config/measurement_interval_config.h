@@ -0,0 +1,23 @@
+/***************************************************************************//**
+ * @file
+ * @brief Measurement Interval characteristic configuration.
+ ******************************************************************************/
+
+#ifndef MEASUREMENT_INTERVAL_CONFIG_H
+#define MEASUREMENT_INTERVAL_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <o MEASUREMENT_INTERVAL_DEFAULT_S> Default interval [s] <1-65535>
+// <i> Used until a client writes the Measurement Interval characteristic.
+// <i> Default: 1
+#define MEASUREMENT_INTERVAL_DEFAULT_S        1
+
+// <o MEASUREMENT_INTERVAL_NVM_KEY> Persistent store key <0x4000-0x407F>
+// <i> User key under which the interval survives reboots.
+// <i> Default: 0x4000
+#define MEASUREMENT_INTERVAL_NVM_KEY          0x4000
+
+// <<< end of configuration section >>>
+
+#endif // MEASUREMENT_INTERVAL_CONFIG_H
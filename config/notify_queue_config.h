@@ -0,0 +1,25 @@
+/***************************************************************************//**
+ * @file
+ * @brief Back-pressure aware notification queue configuration.
+ ******************************************************************************/
+
+#ifndef NOTIFY_QUEUE_CONFIG_H
+#define NOTIFY_QUEUE_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <o NOTIFY_QUEUE_MAX_VALUE> Largest queued value [bytes] <2-64>
+// <i> Values of queued characteristics longer than this are rejected.
+// <i> Default: 9
+#define NOTIFY_QUEUE_MAX_VALUE             9
+
+// <o NOTIFY_QUEUE_RETRY_MS> Retry delay [ms] <1-1000>
+// <i> Delay before values refused by the stack are offered again. The
+// <i> stack frees its buffers as packets are acknowledged, so about one
+// <i> connection interval is enough.
+// <i> Default: 15
+#define NOTIFY_QUEUE_RETRY_MS              15
+
+// <<< end of configuration section >>>
+
+#endif // NOTIFY_QUEUE_CONFIG_H
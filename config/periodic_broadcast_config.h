@@ -0,0 +1,43 @@
+/***************************************************************************//**
+ * @file
+ * @brief Periodic advertising sensor broadcast configuration.
+ ******************************************************************************/
+
+#ifndef PERIODIC_BROADCAST_CONFIG_H
+#define PERIODIC_BROADCAST_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q PERIODIC_BROADCAST_ENABLE> Publish sample batches on a periodic advertising train
+// <i> A second, non-connectable extended advertising set points synchronized
+// <i> scanners to a periodic train carrying the most recent samples.
+// <i> Every sensor is then sampled at its period whether or not a peer
+// <i> subscribes.
+// <i> The option also sizes the stack: with it on, the second advertising
+// <i> set, one periodic-capable set and 500 bytes of stack buffer are
+// <i> reserved. The bluetooth_feature_extended_advertiser and
+// <i> bluetooth_feature_periodic_advertiser components stay in the project
+// <i> either way, since the project file cannot follow this option; remove
+// <i> them from soc_empty_tf_am.slcp to save their code in builds that
+// <i> leave the train off.
+// <i> Default: 0
+#define PERIODIC_BROADCAST_ENABLE          0
+
+// <o PERIODIC_BROADCAST_INTERVAL> Periodic advertising interval [1.25 ms] <6-65535>
+// <i> Default: 800 (1 s)
+#define PERIODIC_BROADCAST_INTERVAL        800
+
+// <o PERIODIC_BROADCAST_ADV_INTERVAL> Extended advertising interval [0.625 ms] <32-16777215>
+// <i> Interval of the extended advertisements announcing the train.
+// <i> Default: 1600 (1 s)
+#define PERIODIC_BROADCAST_ADV_INTERVAL    1600
+
+// <o PERIODIC_BROADCAST_RECORDS> Samples carried per periodic event <1-48>
+// <i> The train carries a sliding window of the most recent samples.
+// <i> 48 records fill 246 bytes, one AUX_SYNC_IND without chaining.
+// <i> Default: 48
+#define PERIODIC_BROADCAST_RECORDS         48
+
+// <<< end of configuration section >>>
+
+#endif // PERIODIC_BROADCAST_CONFIG_H
@@ -0,0 +1,29 @@
+/***************************************************************************//**
+ * @file
+ * @brief PHY selection policy configuration.
+ ******************************************************************************/
+
+#ifndef PHY_POLICY_CONFIG_H
+#define PHY_POLICY_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <o PHY_POLICY_BULK_PHY> Preferred PHY for bulk transfers
+// <1=> LE 1M
+// <2=> LE 2M
+// <4=> LE Coded
+// <i> Default: LE 2M
+#define PHY_POLICY_BULK_PHY                2
+
+// <o PHY_POLICY_RANGE_PHY> Preferred PHY outside bulk transfers
+// <1=> LE 1M
+// <2=> LE 2M
+// <4=> LE Coded
+// <i> LE Coded requires a part with long-range support; EFR32xG12 only has
+// <i> 1M and 2M, so the stack keeps 1M there.
+// <i> Default: LE 1M
+#define PHY_POLICY_RANGE_PHY               1
+
+// <<< end of configuration section >>>
+
+#endif // PHY_POLICY_CONFIG_H
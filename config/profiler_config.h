@@ -0,0 +1,23 @@
+/***************************************************************************//**
+ * @file
+ * @brief Hot-path profiler configuration.
+ ******************************************************************************/
+
+#ifndef PROFILER_CONFIG_H
+#define PROFILER_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q PROFILER_ENABLE> Emit profiling zones over ITM
+// <i> When disabled, PROFILER_BEGIN/PROFILER_END compile to nothing.
+// <i> Default: 0
+#define PROFILER_ENABLE                    0
+
+// <o PROFILER_ITM_CHANNEL> ITM stimulus port <1-31>
+// <i> Port 0 is left to text output.
+// <i> Default: 8
+#define PROFILER_ITM_CHANNEL               8
+
+// <<< end of configuration section >>>
+
+#endif // PROFILER_CONFIG_H
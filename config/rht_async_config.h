@@ -0,0 +1,38 @@
+/***************************************************************************//**
+ * @file
+ * @brief Asynchronous Si7021 RHT acquisition configuration.
+ ******************************************************************************/
+
+#ifndef RHT_ASYNC_CONFIG_H
+#define RHT_ASYNC_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Si7021 acquisition settings
+
+// <o RHT_ASYNC_I2C_ADDRESS> 7-bit I2C address of the Si7021
+// <i> Default: 0x40
+#define RHT_ASYNC_I2C_ADDRESS              0x40
+
+// <o RHT_ASYNC_CONVERSION_TIME_MS> Conversion time [ms] <1-100>
+// <i> Time waited between the "measure RH, no hold master" command and the
+// <i> first read-back attempt. The Si7021 needs up to 12 ms for a 12-bit RH
+// <i> conversion plus 10.8 ms for the 14-bit temperature that comes with it.
+// <i> Default: 23
+#define RHT_ASYNC_CONVERSION_TIME_MS       23
+
+// <o RHT_ASYNC_RETRY_DELAY_MS> Read-back retry delay [ms] <1-100>
+// <i> Delay before polling again when the sensor NACKs the read-back
+// <i> because the conversion is still running.
+// <i> Default: 2
+#define RHT_ASYNC_RETRY_DELAY_MS           2
+
+// <o RHT_ASYNC_MAX_RETRIES> Maximum read-back retries <0-255>
+// <i> Default: 5
+#define RHT_ASYNC_MAX_RETRIES              5
+
+// </h>
+
+// <<< end of configuration section >>>
+
+#endif // RHT_ASYNC_CONFIG_H
@@ -0,0 +1,31 @@
+/***************************************************************************//**
+ * @file
+ * @brief Batched sample notification configuration.
+ ******************************************************************************/
+
+#ifndef SAMPLE_BATCH_CONFIG_H
+#define SAMPLE_BATCH_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <o SAMPLE_BATCH_RING_SIZE> Sample ring buffer size [samples] <8-1024>
+// <i> Shared by all subscribers; holds what the peer furthest behind
+// <i> still needs. When full, the oldest sample is overwritten.
+// <i> Default: 128
+#define SAMPLE_BATCH_RING_SIZE             128
+
+// <o SAMPLE_BATCH_MAX_LATENCY_MS> Flush deadline [ms] <100-600000>
+// <i> A partially filled batch is sent at the latest this long after its
+// <i> first sample was buffered.
+// <i> Default: 30000
+#define SAMPLE_BATCH_MAX_LATENCY_MS        30000
+
+// <o SAMPLE_BATCH_RETRY_MS> Retry interval [ms] <5-10000>
+// <i> Delay before a peer whose notification the stack refused is
+// <i> offered its samples again.
+// <i> Default: 50
+#define SAMPLE_BATCH_RETRY_MS              50
+
+// <<< end of configuration section >>>
+
+#endif // SAMPLE_BATCH_CONFIG_H
@@ -0,0 +1,102 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sensor filtering and notification deadband configuration.
+ ******************************************************************************/
+
+#ifndef SENSOR_FILTER_CONFIG_H
+#define SENSOR_FILTER_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// Filters work on the characteristic's wire value: 0.01 degC, 0.01 %
+// and 0.1 W/m2. A deadband of 0 notifies every sample; a silence of 0
+// disables the heartbeat.
+
+// <h> Temperature
+
+// <o SENSOR_FILTER_TEMPERATURE_TYPE> Filter
+// <0=> None
+// <1=> Moving average
+// <2=> Exponential moving average
+// <3=> Median
+// <i> Default: 2
+#define SENSOR_FILTER_TEMPERATURE_TYPE             2
+
+// <o SENSOR_FILTER_TEMPERATURE_WINDOW> Moving average / median window [samples] <1-16>
+// <i> Default: 5
+#define SENSOR_FILTER_TEMPERATURE_WINDOW           5
+
+// <o SENSOR_FILTER_TEMPERATURE_EMA_SHIFT> EMA weight of a new sample, as 1/2^n <0-8>
+// <i> Default: 2
+#define SENSOR_FILTER_TEMPERATURE_EMA_SHIFT        2
+
+// <o SENSOR_FILTER_TEMPERATURE_DEADBAND> Deadband [0.01 degC] <0-65535>
+// <i> Default: 10
+#define SENSOR_FILTER_TEMPERATURE_DEADBAND         10
+
+// <o SENSOR_FILTER_TEMPERATURE_MAX_SILENCE_MS> Maximum silence [ms] <0-86400000>
+// <i> Default: 60000
+#define SENSOR_FILTER_TEMPERATURE_MAX_SILENCE_MS   60000
+
+// </h>
+
+// <h> Humidity
+
+// <o SENSOR_FILTER_HUMIDITY_TYPE> Filter
+// <0=> None
+// <1=> Moving average
+// <2=> Exponential moving average
+// <3=> Median
+// <i> Default: 2
+#define SENSOR_FILTER_HUMIDITY_TYPE                2
+
+// <o SENSOR_FILTER_HUMIDITY_WINDOW> Moving average / median window [samples] <1-16>
+// <i> Default: 5
+#define SENSOR_FILTER_HUMIDITY_WINDOW              5
+
+// <o SENSOR_FILTER_HUMIDITY_EMA_SHIFT> EMA weight of a new sample, as 1/2^n <0-8>
+// <i> Default: 2
+#define SENSOR_FILTER_HUMIDITY_EMA_SHIFT           2
+
+// <o SENSOR_FILTER_HUMIDITY_DEADBAND> Deadband [0.01 %] <0-65535>
+// <i> Default: 50
+#define SENSOR_FILTER_HUMIDITY_DEADBAND            50
+
+// <o SENSOR_FILTER_HUMIDITY_MAX_SILENCE_MS> Maximum silence [ms] <0-86400000>
+// <i> Default: 60000
+#define SENSOR_FILTER_HUMIDITY_MAX_SILENCE_MS      60000
+
+// </h>
+
+// <h> Irradiance
+
+// <o SENSOR_FILTER_IRRADIANCE_TYPE> Filter
+// <0=> None
+// <1=> Moving average
+// <2=> Exponential moving average
+// <3=> Median
+// <i> A median drops the spikes of passing shadows and reflections.
+// <i> Default: 3
+#define SENSOR_FILTER_IRRADIANCE_TYPE              3
+
+// <o SENSOR_FILTER_IRRADIANCE_WINDOW> Moving average / median window [samples] <1-16>
+// <i> Default: 5
+#define SENSOR_FILTER_IRRADIANCE_WINDOW            5
+
+// <o SENSOR_FILTER_IRRADIANCE_EMA_SHIFT> EMA weight of a new sample, as 1/2^n <0-8>
+// <i> Default: 2
+#define SENSOR_FILTER_IRRADIANCE_EMA_SHIFT         2
+
+// <o SENSOR_FILTER_IRRADIANCE_DEADBAND> Deadband [0.1 W/m2] <0-65535>
+// <i> Default: 10
+#define SENSOR_FILTER_IRRADIANCE_DEADBAND          10
+
+// <o SENSOR_FILTER_IRRADIANCE_MAX_SILENCE_MS> Maximum silence [ms] <0-86400000>
+// <i> Default: 60000
+#define SENSOR_FILTER_IRRADIANCE_MAX_SILENCE_MS    60000
+
+// </h>
+
+// <<< end of configuration section >>>
+
+#endif // SENSOR_FILTER_CONFIG_H
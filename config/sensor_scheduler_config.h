@@ -0,0 +1,35 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sensor sampling scheduler configuration.
+ ******************************************************************************/
+
+#ifndef SENSOR_SCHEDULER_CONFIG_H
+#define SENSOR_SCHEDULER_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Sampling periods
+
+// <o SENSOR_SCHEDULER_TEMPERATURE_PERIOD_MS> Temperature period [ms] <100-65535000>
+// <i> Default: 1000
+#define SENSOR_SCHEDULER_TEMPERATURE_PERIOD_MS   1000
+
+// <o SENSOR_SCHEDULER_HUMIDITY_PERIOD_MS> Humidity period [ms] <100-65535000>
+// <i> Default: 1000
+#define SENSOR_SCHEDULER_HUMIDITY_PERIOD_MS      1000
+
+// <o SENSOR_SCHEDULER_IRRADIANCE_PERIOD_MS> Irradiance period [ms] <100-65535000>
+// <i> Default: 1000
+#define SENSOR_SCHEDULER_IRRADIANCE_PERIOD_MS    1000
+
+// </h>
+
+// <o SENSOR_SCHEDULER_COALESCE_MS> Coalescing window [ms] <0-1000>
+// <i> Sensors falling due within this window of the earliest one are
+// <i> sampled in the same wake-up.
+// <i> Default: 50
+#define SENSOR_SCHEDULER_COALESCE_MS             50
+
+// <<< end of configuration section >>>
+
+#endif // SENSOR_SCHEDULER_CONFIG_H
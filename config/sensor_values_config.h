@@ -0,0 +1,19 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sensor value cache configuration.
+ ******************************************************************************/
+
+#ifndef SENSOR_VALUES_CONFIG_H
+#define SENSOR_VALUES_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <o SENSOR_VALUES_MAX_AGE_MS> Maximum age served to reads [ms] <0-3600000>
+// <i> A read of an older value re-samples the sensor first and is answered
+// <i> when the new value arrives.
+// <i> Default: 2000
+#define SENSOR_VALUES_MAX_AGE_MS           2000
+
+// <<< end of configuration section >>>
+
+#endif // SENSOR_VALUES_CONFIG_H
@@ -31,6 +31,8 @@
 #ifndef SL_BT_ADVERTISER_CONFIG_H
 #define SL_BT_ADVERTISER_CONFIG_H
 
+#include "periodic_broadcast_config.h"
+
 // <<< Use Configuration Wizard in Context Menu >>>
 // <o SL_BT_CONFIG_USER_ADVERTISERS> Max number of advertising sets reserved for user <0-255>
 // <i> Default: 1
@@ -39,7 +41,13 @@
 // <i> Specifically, if the component "bluetooth_feature_periodic_advertiser" is used, its configuration SL_BT_CONFIG_MAX_PERIODIC_ADVERTISERS specifies how many of the SL_BT_CONFIG_USER_ADVERTISERS advertising sets are capable of periodic advertising. Similarly, if the component bluetooth_feature_pawr_advertiser is used, its configuration SL_BT_CONFIG_MAX_PAWR_ADVERTISERS specifies how many of the periodic advertising sets are capable of Periodic Advertising with Responses.
 // <i>
 // <i> The configuration values must satisfy the condition SL_BT_CONFIG_USER_ADVERTISERS >= SL_BT_CONFIG_MAX_PERIODIC_ADVERTISERS >= SL_BT_CONFIG_MAX_PAWR_ADVERTISERS.
+// <i>
+// <i> The periodic broadcast (PERIODIC_BROADCAST_ENABLE) runs on a second set.
+#if PERIODIC_BROADCAST_ENABLE
+#define SL_BT_CONFIG_USER_ADVERTISERS     (2)
+#else
 #define SL_BT_CONFIG_USER_ADVERTISERS     (1)
+#endif
 // <<< end of configuration section >>>
 
 #endif
@@ -33,6 +33,7 @@
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
 #include "sl_component_catalog.h"
 #endif
+#include "periodic_broadcast_config.h"
 
 // <<< Use Configuration Wizard in Context Menu >>>
 
@@ -66,7 +67,12 @@
 // <i> advertising and scanning. The default value is an estimation for achieving adequate throughput
 // <i> and supporting multiple simultaneous connections. Consider increasing this value for
 // <i> higher data throughput over connections, advertising or scanning long advertisement data.
+// <i> The periodic broadcast (PERIODIC_BROADCAST_ENABLE) needs 500 bytes more for its 246-byte train.
+#if PERIODIC_BROADCAST_ENABLE
+#define SL_BT_CONFIG_BUFFER_SIZE    (3650)
+#else
 #define SL_BT_CONFIG_BUFFER_SIZE    (3150)
+#endif
 
 // </h> End Bluetooth Stack Configuration
 
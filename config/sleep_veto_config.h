@@ -0,0 +1,25 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleep veto attribution configuration.
+ ******************************************************************************/
+
+#ifndef SLEEP_VETO_CONFIG_H
+#define SLEEP_VETO_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <q SLEEP_VETO_ENABLE> Record sleep vetoes
+// <i> Makes app_is_ok_to_sleep() and app_sleep_on_isr_exit() find out
+// <i> which module keeps the MCU in EM0. Without it they only hold the
+// <i> MCU awake for pending scheduler jobs.
+// <i> Default: 1
+#define SLEEP_VETO_ENABLE                  1
+
+// <o SLEEP_VETO_RECORDS> Veto records kept <4-256>
+// <i> Size of the ring of most recent vetoes. Must be a power of two.
+// <i> Default: 32
+#define SLEEP_VETO_RECORDS                 32
+
+// <<< end of configuration section >>>
+
+#endif // SLEEP_VETO_CONFIG_H
@@ -0,0 +1,169 @@
+#include <stddef.h>
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#define LOG_MODULE LINK
+#include "log_module.h"
+#include "connection_table.h"
+#include "connection_params.h"
+#include "phy_policy.h"
+#include "connection_params_config.h"
+
+typedef struct {
+    uint16_t min_interval;
+    uint16_t max_interval;
+    uint16_t latency;
+    uint16_t timeout;
+} params_profile_t;
+
+static const params_profile_t profiles[] = {
+    [CONNECTION_PARAMS_PROFILE_BURST] = {
+        CONNECTION_PARAMS_BURST_MIN_INTERVAL,
+        CONNECTION_PARAMS_BURST_MAX_INTERVAL,
+        CONNECTION_PARAMS_BURST_LATENCY,
+        CONNECTION_PARAMS_BURST_TIMEOUT
+    },
+    [CONNECTION_PARAMS_PROFILE_IDLE] = {
+        CONNECTION_PARAMS_IDLE_MIN_INTERVAL,
+        CONNECTION_PARAMS_IDLE_MAX_INTERVAL,
+        CONNECTION_PARAMS_IDLE_LATENCY,
+        CONNECTION_PARAMS_IDLE_TIMEOUT
+    },
+};
+
+static uint32_t relax_signal = 0;
+static uint32_t hold_ticks = 0;
+static uint32_t hold_expiry = 0;
+static sl_sleeptimer_timer_handle_t hold_timer;
+
+/**************************************************************************/
+/* Hold Timer                                                             */
+/**************************************************************************/
+static void hold_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    sl_bt_external_signal(relax_signal);
+}
+
+// One timer serves every connection in BURST, so only ever bring its
+// expiry forward: the pass it triggers re-arms for the later deadlines.
+static void arm_hold_timer(uint32_t delay_ticks) {
+    uint32_t expiry = sl_sleeptimer_get_tick_count() + delay_ticks;
+    bool running = false;
+
+    sl_sleeptimer_is_timer_running(&hold_timer, &running);
+    if (running && (int32_t)(hold_expiry - expiry) <= 0) {
+        return;
+    }
+    hold_expiry = expiry;
+    sl_sleeptimer_restart_timer(&hold_timer,
+                                delay_ticks,
+                                hold_timer_callback,
+                                NULL,
+                                0,
+                                0);
+}
+
+/**************************************************************************/
+/* Parameter Request                                                      */
+/**************************************************************************/
+static void request_profile(connection_entry_t *entry, connection_params_profile_t profile) {
+    const params_profile_t *p = &profiles[profile];
+
+    // Ask once per profile change; the central may refuse or pick other
+    // values, which is then left as is until the profile changes again.
+    // A request the stack rejects leaves the entry in BURST, so the hold
+    // timer pass asks for IDLE again later.
+    if (entry->params_profile == profile) {
+        return;
+    }
+    entry->params_profile = profile;
+    sl_status_t sc = sl_bt_connection_set_parameters(entry->handle,
+                                                     p->min_interval,
+                                                     p->max_interval,
+                                                     p->latency,
+                                                     p->timeout,
+                                                     0,
+                                                     0xFFFF);
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to request connection parameters: 0x%lX\n", sc);
+        entry->params_profile = CONNECTION_PARAMS_PROFILE_BURST;
+        // Keep the PHY on the profile the link actually has.
+        return;
+    }
+    // Bulk traffic also wants the faster PHY, idle links the robust one.
+    phy_policy_request(entry->handle, (profile == CONNECTION_PARAMS_PROFILE_BURST)
+                                      ? PHY_POLICY_MODE_BULK : PHY_POLICY_MODE_RANGE);
+}
+
+static void start_burst(connection_entry_t *entry) {
+    entry->burst_tick = sl_sleeptimer_get_tick_count();
+    request_profile(entry, CONNECTION_PARAMS_PROFILE_BURST);
+    arm_hold_timer(hold_ticks);
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t connection_params_init(uint32_t signal) {
+    relax_signal = signal;
+    return sl_sleeptimer_ms32_to_tick(CONNECTION_PARAMS_BURST_HOLD_MS, &hold_ticks);
+}
+
+void connection_params_burst(uint8_t connection) {
+    connection_entry_t *entry = connection_table_find(connection);
+    if (entry != NULL) {
+        start_burst(entry);
+    }
+}
+
+void connection_params_burst_subscribers(uint16_t characteristic) {
+    for (uint8_t i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        connection_entry_t *entry = connection_table_at(i);
+        if (connection_table_is_subscribed(entry, characteristic)) {
+            start_burst(entry);
+        }
+    }
+}
+
+void connection_params_process(void) {
+    uint32_t now = sl_sleeptimer_get_tick_count();
+    uint32_t next = UINT32_MAX;
+
+    for (uint8_t i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        connection_entry_t *entry = connection_table_at(i);
+        if (entry == NULL || entry->params_profile != CONNECTION_PARAMS_PROFILE_BURST) {
+            continue;
+        }
+        uint32_t elapsed = now - entry->burst_tick;
+        if (elapsed >= hold_ticks) {
+            request_profile(entry, CONNECTION_PARAMS_PROFILE_IDLE);
+            if (entry->params_profile == CONNECTION_PARAMS_PROFILE_BURST) {
+                // Rejected: retry after another hold time.
+                entry->burst_tick = now;
+                if (hold_ticks < next) {
+                    next = hold_ticks;
+                }
+            }
+        } else if (hold_ticks - elapsed < next) {
+            next = hold_ticks - elapsed;
+        }
+    }
+    if (next != UINT32_MAX) {
+        arm_hold_timer(next);
+    }
+}
+
+void connection_params_on_parameters(uint8_t connection,
+                                     uint16_t interval,
+                                     uint16_t latency,
+                                     uint16_t timeout) {
+    connection_entry_t *entry = connection_table_find(connection);
+    if (entry == NULL) {
+        return;
+    }
+    entry->interval = interval;
+    entry->latency = latency;
+    entry->timeout = timeout;
+    LOG_INFO("Connection %u parameters: interval %u x 1.25 ms, latency %u, timeout %u0 ms.\n",
+             connection, interval, latency, timeout);
+}
@@ -0,0 +1,32 @@
+#ifndef CONNECTION_PARAMS_H
+#define CONNECTION_PARAMS_H
+
+#include <stdint.h>
+#include <sl_status.h>
+
+typedef enum {
+    CONNECTION_PARAMS_PROFILE_NONE,     // nothing requested yet
+    CONNECTION_PARAMS_PROFILE_BURST,
+    CONNECTION_PARAMS_PROFILE_IDLE
+} connection_params_profile_t;
+
+// relax_signal is posted through sl_bt_external_signal() when a burst hold
+// time expires; call connection_params_process().
+sl_status_t connection_params_init(uint32_t relax_signal);
+
+// A burst of traffic is in progress on one connection, or on every
+// connection subscribed to a characteristic. Requests the burst profile
+// and (re)starts the hold time.
+void connection_params_burst(uint8_t connection);
+void connection_params_burst_subscribers(uint16_t characteristic);
+
+// Relax connections whose hold time expired to the idle profile.
+void connection_params_process(void);
+
+// Record the parameters from sl_bt_evt_connection_parameters.
+void connection_params_on_parameters(uint8_t connection,
+                                     uint16_t interval,
+                                     uint16_t latency,
+                                     uint16_t timeout);
+
+#endif // CONNECTION_PARAMS_H
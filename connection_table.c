@@ -0,0 +1,185 @@
+#include "sl_bluetooth.h"
+#define LOG_MODULE LINK
+#include "log_module.h"
+#include "gatt_db.h"
+#include "connection_table.h"
+
+// Characteristics whose CCCD state is tracked per connection. The index in
+// this table is the bit position in connection_entry_t.notify_mask.
+static const uint16_t tracked_characteristics[] = {
+    gattdb_temperature,
+    gattdb_humidity_0,
+    gattdb_irradiance_0,
+    gattdb_batched_samples,
+    gattdb_history,
+    gattdb_link_diagnostics,
+};
+
+#define TRACKED_COUNT (sizeof(tracked_characteristics) / sizeof(tracked_characteristics[0]))
+
+static connection_entry_t connections[CONNECTION_TABLE_SIZE];
+
+static int tracked_index(uint16_t characteristic) {
+    for (size_t i = 0; i < TRACKED_COUNT; i++) {
+        if (tracked_characteristics[i] == characteristic) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void reset_entry(connection_entry_t *entry, uint8_t handle) {
+    entry->handle = handle;
+    entry->mtu = CONNECTION_DEFAULT_ATT_MTU;
+    entry->notify_mask = 0;
+    entry->interval = 0;
+    entry->latency = 0;
+    entry->timeout = 0;
+    entry->params_profile = 0;
+    entry->burst_tick = 0;
+    entry->phy = CONNECTION_DEFAULT_PHY;
+    entry->phy_mode = 0;
+    entry->pending_read = 0;
+}
+
+/**************************************************************************/
+/* Lifecycle                                                              */
+/**************************************************************************/
+void connection_table_init(void) {
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        reset_entry(&connections[i], CONNECTION_HANDLE_INVALID);
+    }
+}
+
+sl_status_t connection_table_open(uint8_t handle) {
+    if (connection_table_find(handle) != NULL) {
+        return SL_STATUS_OK;
+    }
+    connection_entry_t *entry = connection_table_find(CONNECTION_HANDLE_INVALID);
+    if (entry == NULL) {
+        LOG_ERROR("Connection table full, handle %u not tracked.\n", handle);
+        return SL_STATUS_FULL;
+    }
+    reset_entry(entry, handle);
+    return SL_STATUS_OK;
+}
+
+void connection_table_close(uint8_t handle) {
+    connection_entry_t *entry = connection_table_find(handle);
+    if (entry != NULL) {
+        reset_entry(entry, CONNECTION_HANDLE_INVALID);
+    }
+}
+
+void connection_table_set_mtu(uint8_t handle, uint16_t mtu) {
+    connection_entry_t *entry = connection_table_find(handle);
+    if (entry != NULL) {
+        entry->mtu = mtu;
+    }
+}
+
+bool connection_table_set_notify(uint8_t handle, uint16_t characteristic, bool enabled) {
+    int index = tracked_index(characteristic);
+    connection_entry_t *entry = connection_table_find(handle);
+    if (index < 0 || entry == NULL) {
+        return false;
+    }
+    if (enabled) {
+        entry->notify_mask |= (1UL << index);
+    } else {
+        entry->notify_mask &= ~(1UL << index);
+    }
+    return true;
+}
+
+/**************************************************************************/
+/* Queries                                                                */
+/**************************************************************************/
+connection_entry_t *connection_table_find(uint8_t handle) {
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        if (connections[i].handle == handle) {
+            return &connections[i];
+        }
+    }
+    return NULL;
+}
+
+connection_entry_t *connection_table_at(uint8_t index) {
+    if (index >= CONNECTION_TABLE_SIZE || connections[index].handle == CONNECTION_HANDLE_INVALID) {
+        return NULL;
+    }
+    return &connections[index];
+}
+
+uint8_t connection_table_count(void) {
+    uint8_t count = 0;
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        if (connections[i].handle != CONNECTION_HANDLE_INVALID) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool connection_table_is_subscribed(const connection_entry_t *entry, uint16_t characteristic) {
+    int index = tracked_index(characteristic);
+    return entry != NULL && index >= 0 && (entry->notify_mask & (1UL << index)) != 0;
+}
+
+bool connection_table_any_subscribed(uint16_t characteristic) {
+    int index = tracked_index(characteristic);
+    if (index < 0) {
+        return false;
+    }
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        if (connections[i].handle != CONNECTION_HANDLE_INVALID
+            && (connections[i].notify_mask & (1UL << index))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint16_t connection_table_min_mtu(uint16_t characteristic) {
+    int index = tracked_index(characteristic);
+    uint16_t mtu = UINT16_MAX;
+
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        if (connections[i].handle != CONNECTION_HANDLE_INVALID
+            && index >= 0
+            && (connections[i].notify_mask & (1UL << index))
+            && connections[i].mtu < mtu) {
+            mtu = connections[i].mtu;
+        }
+    }
+    return (mtu == UINT16_MAX) ? CONNECTION_DEFAULT_ATT_MTU : mtu;
+}
+
+/**************************************************************************/
+/* Notification Fan-out                                                   */
+/**************************************************************************/
+uint8_t connection_table_notify_all(uint16_t characteristic, size_t len, const uint8_t *data) {
+    int index = tracked_index(characteristic);
+    uint8_t sent = 0;
+
+    if (index < 0) {
+        return 0;
+    }
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        if (connections[i].handle == CONNECTION_HANDLE_INVALID
+            || !(connections[i].notify_mask & (1UL << index))) {
+            continue;
+        }
+        sl_status_t sc = sl_bt_gatt_server_send_notification(connections[i].handle,
+                                                             characteristic,
+                                                             len,
+                                                             data);
+        if (sc == SL_STATUS_OK) {
+            sent++;
+        } else {
+            LOG_ERROR("Notification to connection %u failed: 0x%lX\n",
+                      connections[i].handle, sc);
+        }
+    }
+    return sent;
+}
@@ -0,0 +1,61 @@
+#ifndef CONNECTION_TABLE_H
+#define CONNECTION_TABLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <sl_status.h>
+#include "sl_bluetooth_connection_config.h"
+
+#define CONNECTION_TABLE_SIZE          SL_BT_CONFIG_MAX_CONNECTIONS
+#define CONNECTION_HANDLE_INVALID      0xff
+#define CONNECTION_DEFAULT_ATT_MTU     23
+#define CONNECTION_DEFAULT_PHY         0x01    // LE 1M
+
+typedef struct {
+    uint8_t handle;          // CONNECTION_HANDLE_INVALID when the slot is free
+    uint16_t mtu;            // negotiated ATT MTU
+    uint32_t notify_mask;    // one bit per tracked characteristic
+    uint16_t interval;       // current connection interval [1.25 ms]
+    uint16_t latency;        // current peripheral latency [events]
+    uint16_t timeout;        // current supervision timeout [10 ms]
+    uint8_t params_profile;  // profile last requested by connection_params
+    uint32_t burst_tick;     // sleeptimer tick of the last traffic burst
+    uint8_t phy;             // PHY in use, sl_bt_gap_phy_type_t bit
+    uint8_t phy_mode;        // mode last requested by phy_policy
+    uint16_t pending_read;   // characteristic whose read waits for a sample, 0 if none
+} connection_entry_t;
+
+void connection_table_init(void);
+
+// Populate from connection_opened / connection_closed / mtu_exchanged.
+// connection_table_open() returns SL_STATUS_FULL if no slot is left.
+sl_status_t connection_table_open(uint8_t handle);
+void connection_table_close(uint8_t handle);
+void connection_table_set_mtu(uint8_t handle, uint16_t mtu);
+
+// Update the CCCD state of one peer from a characteristic_status event.
+// Returns false if the characteristic is not tracked by the table.
+bool connection_table_set_notify(uint8_t handle, uint16_t characteristic, bool enabled);
+
+connection_entry_t *connection_table_find(uint8_t handle);
+
+// Slot by index, 0 .. CONNECTION_TABLE_SIZE-1; NULL if the slot is free.
+connection_entry_t *connection_table_at(uint8_t index);
+uint8_t connection_table_count(void);
+
+// True if this peer has notifications enabled for the characteristic.
+bool connection_table_is_subscribed(const connection_entry_t *entry, uint16_t characteristic);
+
+// True if at least one connected peer has notifications enabled.
+bool connection_table_any_subscribed(uint16_t characteristic);
+
+// Smallest ATT MTU among the peers subscribed to the characteristic, so a
+// single payload fits all of them (default MTU if none).
+uint16_t connection_table_min_mtu(uint16_t characteristic);
+
+// Send one notification to every peer subscribed to the characteristic.
+// Returns the number of peers the stack accepted it for.
+uint8_t connection_table_notify_all(uint16_t characteristic, size_t len, const uint8_t *data);
+
+#endif // CONNECTION_TABLE_H
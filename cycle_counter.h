@@ -0,0 +1,23 @@
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include <stdint.h>
+#include "em_device.h"
+
+/**************************************************************************/
+/* DWT cycle counter, shared by the event statistics and the profiler.    */
+/* Counts core clock cycles and wraps every 2^32 cycles (111 s at         */
+/* 38.4 MHz); durations are taken as unsigned differences.                */
+/**************************************************************************/
+
+static inline void cycle_counter_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t cycle_counter_get(void) {
+    return DWT->CYCCNT;
+}
+
+#endif // CYCLE_COUNTER_H
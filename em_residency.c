@@ -0,0 +1,174 @@
+#include <string.h>
+#include "em_core.h"
+#include "em_device.h"
+#include "sl_bluetooth.h"
+#include "sl_power_manager.h"
+#include "sl_sleeptimer.h"
+#define LOG_MODULE DIAGNOSTICS
+#include "log_module.h"
+#include "em_residency.h"
+#include "em_residency_config.h"
+
+#define WAKE_IRQ_COUNT   64
+
+static uint64_t mode_ticks[EM_RESIDENCY_MODES];
+static uint32_t wake_counts[WAKE_IRQ_COUNT];
+static uint32_t wakeups = 0;
+static uint64_t init_tick = 0;
+static uint64_t last_tick = 0;
+static sl_power_manager_em_t current_mode = SL_POWER_MANAGER_EM0;
+static uint32_t log_signal = 0;
+static sl_sleeptimer_timer_handle_t log_timer;
+static sl_power_manager_em_transition_event_handle_t transition_handle;
+
+static void on_transition(sl_power_manager_em_t from, sl_power_manager_em_t to);
+
+static const sl_power_manager_em_transition_event_info_t transition_info = {
+    .event_mask = SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM0
+                  | SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM1
+                  | SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM2
+                  | SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM3,
+    .on_event = on_transition
+};
+
+/**************************************************************************/
+/* Transition Callback                                                    */
+/* Runs in the sleep path with interrupts masked; keep it short.          */
+/**************************************************************************/
+static void on_transition(sl_power_manager_em_t from, sl_power_manager_em_t to) {
+    uint64_t now = sl_sleeptimer_get_tick_count64();
+
+    if (from < EM_RESIDENCY_MODES) {
+        mode_ticks[from] += now - last_tick;
+    }
+    last_tick = now;
+    current_mode = to;
+
+    if (to == SL_POWER_MANAGER_EM0 && from != SL_POWER_MANAGER_EM0) {
+        // The interrupt that ended the sleep is still pending here.
+        wakeups++;
+        for (uint32_t word = 0; word < WAKE_IRQ_COUNT / 32; word++) {
+            uint32_t pending = NVIC->ISPR[word] & NVIC->ISER[word];
+            if (pending != 0) {
+                wake_counts[word * 32 + __builtin_ctz(pending)]++;
+                break;
+            }
+        }
+    }
+}
+
+static void log_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    sl_bt_external_signal(log_signal);
+}
+
+static uint32_t ticks_to_ms(uint64_t ticks) {
+    uint64_t ms = 0;
+    sl_sleeptimer_tick64_to_ms(ticks, &ms);
+    return (uint32_t)ms;
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t em_residency_init(uint32_t signal) {
+    log_signal = signal;
+    init_tick = sl_sleeptimer_get_tick_count64();
+    last_tick = init_tick;
+    sl_power_manager_subscribe_em_transition_event(&transition_handle, &transition_info);
+#if EM_RESIDENCY_LOG_PERIOD_S > 0
+    return sl_sleeptimer_start_periodic_timer_ms(&log_timer,
+                                                 EM_RESIDENCY_LOG_PERIOD_S * 1000UL,
+                                                 log_timer_callback,
+                                                 NULL,
+                                                 0,
+                                                 0);
+#else
+    return SL_STATUS_OK;
+#endif
+}
+
+void em_residency_get(em_residency_t *out) {
+    uint64_t ticks[EM_RESIDENCY_MODES];
+    uint32_t counts[WAKE_IRQ_COUNT];
+    uint64_t now;
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    now = sl_sleeptimer_get_tick_count64();
+    memcpy(ticks, mode_ticks, sizeof(ticks));
+    memcpy(counts, wake_counts, sizeof(counts));
+    // Include the time spent in the mode we are in right now.
+    if (current_mode < EM_RESIDENCY_MODES) {
+        ticks[current_mode] += now - last_tick;
+    }
+    out->wakeups = wakeups;
+    CORE_EXIT_ATOMIC();
+
+    // 64-bit like the per-mode sums, so the total keeps matching them
+    // past the 32-bit tick wrap (36.4 h).
+    out->total_ms = ticks_to_ms(now - init_tick);
+    for (int mode = 0; mode < EM_RESIDENCY_MODES; mode++) {
+        out->mode_ms[mode] = ticks_to_ms(ticks[mode]);
+    }
+    for (int rank = 0; rank < EM_RESIDENCY_TOP_SOURCES; rank++) {
+        uint32_t best = 0;
+        out->top_sources[rank].irq = 0xFF;
+        out->top_sources[rank].count = 0;
+        for (int irq = 0; irq < WAKE_IRQ_COUNT; irq++) {
+            if (counts[irq] > counts[best]) {
+                best = irq;
+            }
+        }
+        if (counts[best] == 0) {
+            break;
+        }
+        out->top_sources[rank].irq = (uint8_t)best;
+        out->top_sources[rank].count = (counts[best] > UINT16_MAX) ? UINT16_MAX : (uint16_t)counts[best];
+        counts[best] = 0;
+    }
+}
+
+size_t em_residency_encode(uint8_t *buf) {
+    em_residency_t residency;
+    uint32_t words[2 + EM_RESIDENCY_MODES];
+    size_t len = 0;
+
+    em_residency_get(&residency);
+    words[0] = residency.total_ms;
+    for (int mode = 0; mode < EM_RESIDENCY_MODES; mode++) {
+        words[1 + mode] = residency.mode_ms[mode];
+    }
+    words[1 + EM_RESIDENCY_MODES] = residency.wakeups;
+    for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        buf[len++] = words[i] & 0xFF;
+        buf[len++] = (words[i] >> 8) & 0xFF;
+        buf[len++] = (words[i] >> 16) & 0xFF;
+        buf[len++] = (words[i] >> 24) & 0xFF;
+    }
+    for (int rank = 0; rank < EM_RESIDENCY_TOP_SOURCES; rank++) {
+        buf[len++] = residency.top_sources[rank].irq;
+        buf[len++] = residency.top_sources[rank].count & 0xFF;
+        buf[len++] = (residency.top_sources[rank].count >> 8) & 0xFF;
+    }
+    return len;
+}
+
+void em_residency_log(void) {
+    em_residency_t residency;
+
+    em_residency_get(&residency);
+    LOG_INFO("EM residency over %lu ms: EM0 %lu, EM1 %lu, EM2 %lu, EM3 %lu ms, %lu wake-ups.\n",
+             (unsigned long)residency.total_ms,
+             (unsigned long)residency.mode_ms[0],
+             (unsigned long)residency.mode_ms[1],
+             (unsigned long)residency.mode_ms[2],
+             (unsigned long)residency.mode_ms[3],
+             (unsigned long)residency.wakeups);
+    for (int rank = 0; rank < EM_RESIDENCY_TOP_SOURCES && residency.top_sources[rank].irq != 0xFF; rank++) {
+        LOG_INFO("  wake-up IRQ %u: %u times\n",
+                 residency.top_sources[rank].irq,
+                 residency.top_sources[rank].count);
+    }
+}
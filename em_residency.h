@@ -0,0 +1,34 @@
+#ifndef EM_RESIDENCY_H
+#define EM_RESIDENCY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sl_status.h>
+
+#define EM_RESIDENCY_MODES         4       // EM0 .. EM3
+#define EM_RESIDENCY_TOP_SOURCES   3
+
+typedef struct {
+    uint32_t total_ms;                          // since init
+    uint32_t mode_ms[EM_RESIDENCY_MODES];
+    uint32_t wakeups;                           // exits from EM1 and below
+    struct {
+        uint8_t irq;                            // 0xFF if unused
+        uint16_t count;
+    } top_sources[EM_RESIDENCY_TOP_SOURCES];    // most frequent wake-up IRQs
+} em_residency_t;
+
+// Power Diagnostics value (little-endian): uint32 total_ms, uint32 ms in
+// EM0, EM1, EM2 and EM3, uint32 wakeups, then three (uint8 IRQ number,
+// uint16 count) for the most frequent wake-up sources, 0xFF if unused.
+#define EM_RESIDENCY_ENCODED_SIZE  (4 * (2 + EM_RESIDENCY_MODES) + 3 * EM_RESIDENCY_TOP_SOURCES)
+
+// log_signal is posted through sl_bt_external_signal() every log period;
+// call em_residency_log().
+sl_status_t em_residency_init(uint32_t log_signal);
+
+void em_residency_get(em_residency_t *out);
+size_t em_residency_encode(uint8_t *buf);
+void em_residency_log(void);
+
+#endif // EM_RESIDENCY_H
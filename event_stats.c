@@ -0,0 +1,121 @@
+#include <stddef.h>
+#include "em_device.h"
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#define LOG_MODULE DIAGNOSTICS
+#include "log_module.h"
+#include "cycle_counter.h"
+#include "event_stats.h"
+#include "event_stats_config.h"
+
+typedef struct {
+    uint32_t event_id;
+    const char *name;
+} event_class_t;
+
+// Events the application handles; everything else is counted as "other".
+static const event_class_t classes[] = {
+    { sl_bt_evt_system_boot_id, "boot" },
+    { sl_bt_evt_connection_opened_id, "conn_opened" },
+    { sl_bt_evt_connection_closed_id, "conn_closed" },
+    { sl_bt_evt_connection_parameters_id, "conn_params" },
+    { sl_bt_evt_connection_phy_status_id, "phy_status" },
+    { sl_bt_evt_gatt_mtu_exchanged_id, "mtu" },
+    { sl_bt_evt_gatt_server_characteristic_status_id, "char_status" },
+    { sl_bt_evt_gatt_server_user_read_request_id, "user_read" },
+    { sl_bt_evt_gatt_server_user_write_request_id, "user_write" },
+    { sl_bt_evt_system_external_signal_id, "ext_signal" },
+};
+
+#define CLASS_COUNT (sizeof(classes) / sizeof(classes[0]))
+
+typedef struct {
+    uint32_t count;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+} event_counters_t;
+
+static event_counters_t counters[CLASS_COUNT + 1];
+static uint32_t period_start_tick = 0;
+
+#if EVENT_STATS_ENABLE
+static uint32_t report_signal = 0;
+static sl_sleeptimer_timer_handle_t report_timer;
+
+static void report_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    sl_bt_external_signal(report_signal);
+}
+#endif
+
+// Scale before dividing: SystemCoreClockGet() / 1000000 truncates clocks
+// that are not whole MHz (38.4 MHz HFXO reads as 38).
+static uint32_t cycles_to_us(uint64_t cycles) {
+    return (uint32_t)((cycles * 1000000ULL) / SystemCoreClockGet());
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t event_stats_init(uint32_t signal) {
+#if EVENT_STATS_ENABLE
+    report_signal = signal;
+    cycle_counter_init();
+    period_start_tick = sl_sleeptimer_get_tick_count();
+    return sl_sleeptimer_start_periodic_timer_ms(&report_timer,
+                                                 EVENT_STATS_REPORT_PERIOD_S * 1000UL,
+                                                 report_timer_callback,
+                                                 NULL,
+                                                 0,
+                                                 0);
+#else
+    (void)signal;
+    return SL_STATUS_OK;
+#endif
+}
+
+void event_stats_record(uint32_t event_id, uint32_t cycles) {
+    size_t i = 0;
+    while (i < CLASS_COUNT && classes[i].event_id != event_id) {
+        i++;
+    }
+    counters[i].count++;
+    counters[i].total_cycles += cycles;
+    if (cycles > counters[i].max_cycles) {
+        counters[i].max_cycles = cycles;
+    }
+}
+
+void event_stats_report(void) {
+    uint32_t period_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count() - period_start_tick);
+    uint32_t total = 0;
+    uint64_t rate_x100;
+
+    if (period_ms == 0) {
+        return;
+    }
+    for (size_t i = 0; i <= CLASS_COUNT; i++) {
+        total += counters[i].count;
+    }
+    rate_x100 = (uint64_t)total * 100000UL / period_ms;
+    LOG_INFO("Event stats: %lu events in %lu ms (%lu.%02lu events/s)\n",
+             (unsigned long)total,
+             (unsigned long)period_ms,
+             (unsigned long)(rate_x100 / 100),
+             (unsigned long)(rate_x100 % 100));
+    for (size_t i = 0; i <= CLASS_COUNT; i++) {
+        if (counters[i].count == 0) {
+            continue;
+        }
+        LOG_INFO("  %-12s n=%lu mean=%lu us max=%lu us\n",
+                 (i < CLASS_COUNT) ? classes[i].name : "other",
+                 (unsigned long)counters[i].count,
+                 (unsigned long)cycles_to_us(counters[i].total_cycles / counters[i].count),
+                 (unsigned long)cycles_to_us(counters[i].max_cycles));
+        counters[i].count = 0;
+        counters[i].total_cycles = 0;
+        counters[i].max_cycles = 0;
+    }
+    period_start_tick = sl_sleeptimer_get_tick_count();
+}
@@ -0,0 +1,18 @@
+#ifndef EVENT_STATS_H
+#define EVENT_STATS_H
+
+#include <stdint.h>
+#include <sl_status.h>
+
+// report_signal is posted through sl_bt_external_signal() every report
+// period; call event_stats_report().
+sl_status_t event_stats_init(uint32_t report_signal);
+
+// Account one handled event: its SL_BT_MSG_ID and handling time in cycles.
+void event_stats_record(uint32_t event_id, uint32_t cycles);
+
+// Log events/s, mean and worst-case handling time per event type since the
+// last report, then start a new period.
+void event_stats_report(void);
+
+#endif // EVENT_STATS_H
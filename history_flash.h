@@ -0,0 +1,44 @@
+#ifndef HISTORY_FLASH_H
+#define HISTORY_FLASH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <sl_status.h>
+
+/**************************************************************************/
+/* NOR flash used by the sample history log.                              */
+/*                                                                        */
+/* history_log.c only reaches the flash through this interface, so the    */
+/* MX25 driver can be swapped for a file-backed emulator when the log     */
+/* format is exercised off-target. Erased bytes read back as 0xFF and     */
+/* programming can only clear bits.                                       */
+/**************************************************************************/
+
+#define HISTORY_FLASH_PAGE_SIZE      256
+#define HISTORY_FLASH_SECTOR_SIZE    4096
+
+// Bring up the bus and identify the part. Returns SL_STATUS_NOT_FOUND if
+// no supported flash answers.
+sl_status_t history_flash_init(void);
+
+// Capacity in bytes, 0 before a successful init.
+uint32_t history_flash_size(void);
+
+// Returns SL_STATUS_BUSY without waiting while a sector erase runs.
+sl_status_t history_flash_read(uint32_t address, uint8_t *buf, size_t len);
+
+// Program len bytes within one page. Waits for a previous erase or program
+// to complete first.
+sl_status_t history_flash_program(uint32_t address, const uint8_t *data, size_t len);
+
+// Start erasing the sector holding address and return without waiting.
+// The part stays powered until history_flash_busy() or the next access
+// sees the erase done.
+sl_status_t history_flash_erase_sector(uint32_t address);
+
+// True while an erase runs. Polls the part without waiting and puts it
+// back into deep power-down once the erase has completed.
+bool history_flash_busy(void);
+
+#endif // HISTORY_FLASH_H
@@ -0,0 +1,203 @@
+#include <stdbool.h>
+#include "em_cmu.h"
+#include "em_gpio.h"
+#include "em_usart.h"
+#include "sl_udelay.h"
+#include "sl_mx25_flash_shutdown_usart_config.h"
+#include "history_flash.h"
+
+// The log shares the USART and pins the board configures for the MX25
+// power-down driver, which leaves the part in deep power-down at boot.
+#define FLASH_USART                  SL_MX25_FLASH_SHUTDOWN_PERIPHERAL
+#define FLASH_USART_CLOCK            cmuClock_USART2
+#define FLASH_SPI_BAUDRATE           8000000
+
+#if (SL_MX25_FLASH_SHUTDOWN_PERIPHERAL_NO != 2)
+#error "history_flash_mx25.c expects the MX25 flash on USART2."
+#endif
+
+// MX25 commands
+#define MX25_CMD_READ                0x03
+#define MX25_CMD_PAGE_PROGRAM        0x02
+#define MX25_CMD_SECTOR_ERASE        0x20
+#define MX25_CMD_WRITE_ENABLE        0x06
+#define MX25_CMD_READ_STATUS         0x05
+#define MX25_CMD_READ_ID             0x9F
+#define MX25_CMD_DEEP_POWER_DOWN     0xB9
+#define MX25_CMD_RELEASE_POWER_DOWN  0xAB
+#define MX25_STATUS_WIP              0x01
+#define MX25_MANUFACTURER_ID         0xC2
+#define MX25_WAKEUP_US               35
+
+static uint32_t flash_size = 0;
+static bool powered_down = true;
+static bool erasing = false;
+
+/**************************************************************************/
+/* SPI Helpers                                                            */
+/**************************************************************************/
+static void chip_select(void) {
+    GPIO_PinOutClear(SL_MX25_FLASH_SHUTDOWN_CS_PORT, SL_MX25_FLASH_SHUTDOWN_CS_PIN);
+}
+
+static void chip_deselect(void) {
+    GPIO_PinOutSet(SL_MX25_FLASH_SHUTDOWN_CS_PORT, SL_MX25_FLASH_SHUTDOWN_CS_PIN);
+}
+
+static void command(uint8_t cmd) {
+    chip_select();
+    USART_SpiTransfer(FLASH_USART, cmd);
+    chip_deselect();
+}
+
+static void command_address(uint8_t cmd, uint32_t address) {
+    USART_SpiTransfer(FLASH_USART, cmd);
+    USART_SpiTransfer(FLASH_USART, (address >> 16) & 0xFF);
+    USART_SpiTransfer(FLASH_USART, (address >> 8) & 0xFF);
+    USART_SpiTransfer(FLASH_USART, address & 0xFF);
+}
+
+static uint8_t read_status(void) {
+    chip_select();
+    USART_SpiTransfer(FLASH_USART, MX25_CMD_READ_STATUS);
+    uint8_t status = USART_SpiTransfer(FLASH_USART, 0xFF);
+    chip_deselect();
+    return status;
+}
+
+static void wake(void) {
+    if (powered_down) {
+        command(MX25_CMD_RELEASE_POWER_DOWN);
+        sl_udelay_wait(MX25_WAKEUP_US);
+        powered_down = false;
+    }
+}
+
+static void wait_ready(void) {
+    while (read_status() & MX25_STATUS_WIP) {
+    }
+    erasing = false;
+}
+
+// Deep power-down is ignored while an erase runs, so only enter it idle.
+static void sleep_if_idle(void) {
+    if (!(read_status() & MX25_STATUS_WIP)) {
+        command(MX25_CMD_DEEP_POWER_DOWN);
+        powered_down = true;
+    }
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t history_flash_init(void) {
+    USART_InitSync_TypeDef init = USART_INITSYNC_DEFAULT;
+    uint8_t id[3];
+
+    CMU_ClockEnable(cmuClock_GPIO, true);
+    CMU_ClockEnable(FLASH_USART_CLOCK, true);
+    GPIO_PinModeSet(SL_MX25_FLASH_SHUTDOWN_TX_PORT, SL_MX25_FLASH_SHUTDOWN_TX_PIN, gpioModePushPull, 0);
+    GPIO_PinModeSet(SL_MX25_FLASH_SHUTDOWN_RX_PORT, SL_MX25_FLASH_SHUTDOWN_RX_PIN, gpioModeInput, 0);
+    GPIO_PinModeSet(SL_MX25_FLASH_SHUTDOWN_CLK_PORT, SL_MX25_FLASH_SHUTDOWN_CLK_PIN, gpioModePushPull, 0);
+    GPIO_PinModeSet(SL_MX25_FLASH_SHUTDOWN_CS_PORT, SL_MX25_FLASH_SHUTDOWN_CS_PIN, gpioModePushPull, 1);
+
+    init.baudrate = FLASH_SPI_BAUDRATE;
+    init.msbf = true;
+    USART_InitSync(FLASH_USART, &init);
+    FLASH_USART->ROUTELOC0 = (SL_MX25_FLASH_SHUTDOWN_TX_LOC << _USART_ROUTELOC0_TXLOC_SHIFT)
+                             | (SL_MX25_FLASH_SHUTDOWN_RX_LOC << _USART_ROUTELOC0_RXLOC_SHIFT)
+                             | (SL_MX25_FLASH_SHUTDOWN_CLK_LOC << _USART_ROUTELOC0_CLKLOC_SHIFT);
+    FLASH_USART->ROUTEPEN = USART_ROUTEPEN_TXPEN | USART_ROUTEPEN_RXPEN | USART_ROUTEPEN_CLKPEN;
+
+    powered_down = true;
+    wake();
+    chip_select();
+    USART_SpiTransfer(FLASH_USART, MX25_CMD_READ_ID);
+    for (size_t i = 0; i < sizeof(id); i++) {
+        id[i] = USART_SpiTransfer(FLASH_USART, 0xFF);
+    }
+    chip_deselect();
+    sleep_if_idle();
+
+    // Third ID byte is log2 of the capacity in bytes.
+    if (id[0] != MX25_MANUFACTURER_ID || id[2] < 16 || id[2] > 24) {
+        flash_size = 0;
+        return SL_STATUS_NOT_FOUND;
+    }
+    flash_size = 1UL << id[2];
+    return SL_STATUS_OK;
+}
+
+uint32_t history_flash_size(void) {
+    return flash_size;
+}
+
+sl_status_t history_flash_read(uint32_t address, uint8_t *buf, size_t len) {
+    if (address + len > flash_size) {
+        return SL_STATUS_INVALID_RANGE;
+    }
+    // A sector erase runs for up to a few hundred ms; readers retry later
+    // rather than spin on it.
+    if (erasing) {
+        if (read_status() & MX25_STATUS_WIP) {
+            return SL_STATUS_BUSY;
+        }
+        erasing = false;
+    }
+    wake();
+    chip_select();
+    command_address(MX25_CMD_READ, address);
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = USART_SpiTransfer(FLASH_USART, 0xFF);
+    }
+    chip_deselect();
+    sleep_if_idle();
+    return SL_STATUS_OK;
+}
+
+sl_status_t history_flash_program(uint32_t address, const uint8_t *data, size_t len) {
+    if (address + len > flash_size
+        || (address % HISTORY_FLASH_PAGE_SIZE) + len > HISTORY_FLASH_PAGE_SIZE) {
+        return SL_STATUS_INVALID_RANGE;
+    }
+    wake();
+    wait_ready();
+    command(MX25_CMD_WRITE_ENABLE);
+    chip_select();
+    command_address(MX25_CMD_PAGE_PROGRAM, address);
+    for (size_t i = 0; i < len; i++) {
+        USART_SpiTransfer(FLASH_USART, data[i]);
+    }
+    chip_deselect();
+    // A page program takes about a millisecond; finish it here so the part
+    // can go back to deep power-down.
+    wait_ready();
+    sleep_if_idle();
+    return SL_STATUS_OK;
+}
+
+sl_status_t history_flash_erase_sector(uint32_t address) {
+    if (address >= flash_size) {
+        return SL_STATUS_INVALID_RANGE;
+    }
+    wake();
+    wait_ready();
+    command(MX25_CMD_WRITE_ENABLE);
+    chip_select();
+    command_address(MX25_CMD_SECTOR_ERASE, address - (address % HISTORY_FLASH_SECTOR_SIZE));
+    chip_deselect();
+    erasing = true;
+    return SL_STATUS_OK;
+}
+
+bool history_flash_busy(void) {
+    if (!erasing) {
+        return false;
+    }
+    if (read_status() & MX25_STATUS_WIP) {
+        return true;
+    }
+    erasing = false;
+    sleep_if_idle();
+    return false;
+}
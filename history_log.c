@@ -0,0 +1,516 @@
+#include <stddef.h>
+#include <string.h>
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#define LOG_MODULE HISTORY
+#include "log_module.h"
+#include "app_clock.h"
+#include "gatt_db.h"
+#include "connection_table.h"
+#include "history_flash.h"
+#include "history_log.h"
+#include "history_log_config.h"
+#include "app_scheduler.h"
+#include "profiler.h"
+
+#define PAGE_MAGIC           0x4C48
+#define PAGE_HEADER_SIZE     18
+#define RECORD_SIZE          5
+#define RECORDS_PER_PAGE     ((HISTORY_FLASH_PAGE_SIZE - PAGE_HEADER_SIZE) / RECORD_SIZE)
+#define PAGES_PER_SECTOR     (HISTORY_FLASH_SECTOR_SIZE / HISTORY_FLASH_PAGE_SIZE)
+
+#define STREAM_HEADER_SIZE   10
+#define STREAM_MAX_PAYLOAD   244     // 247-byte ATT MTU minus 3
+
+typedef struct {
+    uint16_t boot;
+    uint32_t page_seq;
+    uint32_t first_seq;
+    uint32_t base_ms;
+    uint8_t count;
+} page_header_t;
+
+typedef struct {
+    uint8_t connection;      // CONNECTION_HANDLE_INVALID when idle
+    uint32_t page;           // flash address of the page being replayed
+    bool in_ram;             // replaying the page still being filled
+    uint32_t seq;            // next sample to send
+    bool located;            // page and in_ram point at seq
+} stream_t;
+
+static bool ready = false;
+static uint32_t stream_signal = 0;
+static uint32_t region_start = 0;
+static uint32_t region_end = 0;
+static uint16_t boot = 0;
+static uint32_t head = 0;                // next page to program
+static uint32_t head_page_seq = 0;
+static uint32_t next_seq = 0;            // sequence of the next sample
+static uint32_t erased_sector = UINT32_MAX;
+static app_job_t *erase_job = NULL;
+
+// Page being filled in RAM.
+static uint8_t page_buf[HISTORY_FLASH_PAGE_SIZE];
+static page_header_t page;
+static uint32_t page_last_ms = 0;
+
+static stream_t stream = { .connection = CONNECTION_HANDLE_INVALID };
+static sl_sleeptimer_timer_handle_t retry_timer;
+
+static void put_u16(uint8_t *buf, uint16_t value) {
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+}
+
+static void put_u32(uint8_t *buf, uint32_t value) {
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+    buf[2] = (value >> 16) & 0xFF;
+    buf[3] = (value >> 24) & 0xFF;
+}
+
+static uint16_t get_u16(const uint8_t *buf) {
+    return (uint16_t)(buf[0] | (buf[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *buf) {
+    return buf[0] | (buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static uint32_t next_page(uint32_t address) {
+    address += HISTORY_FLASH_PAGE_SIZE;
+    return (address >= region_end) ? region_start : address;
+}
+
+static uint32_t sector_of(uint32_t address) {
+    return address - ((address - region_start) % HISTORY_FLASH_SECTOR_SIZE);
+}
+
+/**************************************************************************/
+/* Page Headers                                                           */
+/**************************************************************************/
+static void encode_header(uint8_t *buf, const page_header_t *header) {
+    put_u16(&buf[0], PAGE_MAGIC);
+    put_u16(&buf[2], header->boot);
+    put_u32(&buf[4], header->page_seq);
+    put_u32(&buf[8], header->first_seq);
+    put_u32(&buf[12], header->base_ms);
+    buf[16] = header->count;
+    buf[17] = 0xFF;
+}
+
+static bool decode_header(const uint8_t *buf, page_header_t *header) {
+    if (get_u16(&buf[0]) != PAGE_MAGIC || buf[16] == 0 || buf[16] > RECORDS_PER_PAGE) {
+        return false;
+    }
+    header->boot = get_u16(&buf[2]);
+    header->page_seq = get_u32(&buf[4]);
+    header->first_seq = get_u32(&buf[8]);
+    header->base_ms = get_u32(&buf[12]);
+    header->count = buf[16];
+    return true;
+}
+
+// SL_STATUS_BUSY while an erase runs, SL_STATUS_NOT_FOUND for a page
+// without a valid header.
+static sl_status_t read_header(uint32_t address, page_header_t *header) {
+    uint8_t buf[PAGE_HEADER_SIZE];
+    sl_status_t sc = history_flash_read(address, buf, sizeof(buf));
+
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    return decode_header(buf, header) ? SL_STATUS_OK : SL_STATUS_NOT_FOUND;
+}
+
+/**************************************************************************/
+/* Head Recovery                                                          */
+/**************************************************************************/
+static void find_head(void) {
+    page_header_t header;
+    page_header_t last;
+    uint32_t last_address = UINT32_MAX;
+
+    // The sector whose first page carries the highest page_seq holds the
+    // head; the head is after its last valid page.
+    for (uint32_t sector = region_start; sector < region_end; sector += HISTORY_FLASH_SECTOR_SIZE) {
+        if (read_header(sector, &header) == SL_STATUS_OK
+            && (last_address == UINT32_MAX || header.page_seq > last.page_seq)) {
+            last = header;
+            last_address = sector;
+        }
+    }
+    if (last_address == UINT32_MAX) {
+        head = region_start;
+        head_page_seq = 0;
+        next_seq = 0;
+        boot = 0;
+        return;
+    }
+    for (uint32_t i = 1; i < PAGES_PER_SECTOR; i++) {
+        uint32_t address = last_address + i * HISTORY_FLASH_PAGE_SIZE;
+        if (read_header(address, &header) != SL_STATUS_OK || header.page_seq != last.page_seq + 1) {
+            break;
+        }
+        last = header;
+        last_address = address;
+    }
+    head = next_page(last_address);
+    head_page_seq = last.page_seq + 1;
+    next_seq = last.first_seq + last.count;
+    boot = last.boot + 1;
+}
+
+static bool sector_is_erased(uint32_t sector) {
+    uint8_t buf[64];
+
+    for (uint32_t offset = 0; offset < HISTORY_FLASH_SECTOR_SIZE; offset += sizeof(buf)) {
+        if (history_flash_read(sector + offset, buf, sizeof(buf)) != SL_STATUS_OK) {
+            return false;
+        }
+        for (size_t i = 0; i < sizeof(buf); i++) {
+            if (buf[i] != 0xFF) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void erase_ahead(uint32_t sector) {
+    if (history_flash_erase_sector(sector) == SL_STATUS_OK) {
+        erased_sector = sector;
+        // Poll for the end of the erase so the part powers down as soon
+        // as it is done rather than at the next access.
+        app_scheduler_post_in(erase_job, HISTORY_LOG_ERASE_POLL_MS);
+    }
+}
+
+/**************************************************************************/
+/* Page Commit                                                            */
+/**************************************************************************/
+static void commit_page(void) {
+    bool sector_start = ((head - region_start) % HISTORY_FLASH_SECTOR_SIZE) == 0;
+
+    if (page.count == 0) {
+        return;
+    }
+    if (sector_start && erased_sector != head) {
+        erase_ahead(head);      // program below waits for it
+    }
+    encode_header(page_buf, &page);
+    sl_status_t sc = history_flash_program(head,
+                                           page_buf,
+                                           PAGE_HEADER_SIZE + page.count * RECORD_SIZE);
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to program history page: 0x%lX\n", sc);
+    }
+    if (sector_start) {
+        // Keep the next sector erased so entering it never blocks; this
+        // retires the oldest sector of the log.
+        erase_ahead(sector_of(head + HISTORY_FLASH_SECTOR_SIZE >= region_end
+                              ? region_start : head + HISTORY_FLASH_SECTOR_SIZE));
+    }
+    head = next_page(head);
+    head_page_seq++;
+    page.count = 0;
+}
+
+/**************************************************************************/
+/* Download                                                               */
+/**************************************************************************/
+static void retry_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    sl_bt_external_signal(stream_signal);
+}
+
+// Out of stack buffers or the flash busy erasing: carry on a little later.
+static void stream_retry(void) {
+    sl_sleeptimer_restart_timer_ms(&retry_timer, HISTORY_LOG_RETRY_MS,
+                                   retry_timer_callback, NULL, 0, 0);
+}
+
+// Load the page holding stream.seq, from flash or RAM.
+static sl_status_t load_stream_page(uint8_t *buf, page_header_t *header) {
+    if (stream.in_ram) {
+        encode_header(page_buf, &page);
+        memcpy(buf, page_buf, HISTORY_FLASH_PAGE_SIZE);
+        *header = page;
+        return SL_STATUS_OK;
+    }
+    sl_status_t sc = history_flash_read(stream.page, buf, HISTORY_FLASH_PAGE_SIZE);
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    return decode_header(buf, header) ? SL_STATUS_OK : SL_STATUS_NOT_FOUND;
+}
+
+// Point the stream at the oldest page holding from_seq or later. Returns
+// SL_STATUS_BUSY, with the stream still unlocated, if a header could not
+// be read because the flash is erasing.
+static sl_status_t locate(uint32_t from_seq) {
+    page_header_t header;
+    uint32_t address = head;
+    sl_status_t sc;
+
+    stream.seq = from_seq;
+    if (page.count > 0 && (int32_t)(from_seq - page.first_seq) >= 0) {
+        stream.in_ram = true;
+        return SL_STATUS_OK;
+    }
+    // Walk forward from the oldest sector: the one after the head sector,
+    // skipping the sector kept erased.
+    stream.in_ram = true;
+    for (uint32_t sector = sector_of(head) + HISTORY_FLASH_SECTOR_SIZE, n = 0;
+         n < (region_end - region_start) / HISTORY_FLASH_SECTOR_SIZE;
+         sector += HISTORY_FLASH_SECTOR_SIZE, n++) {
+        if (sector >= region_end) {
+            sector = region_start;
+        }
+        sc = read_header(sector, &header);
+        if (sc == SL_STATUS_BUSY) {
+            return sc;
+        }
+        if (sc != SL_STATUS_OK) {
+            continue;
+        }
+        if ((int32_t)(from_seq - header.first_seq) < 0) {
+            if (stream.in_ram) {
+                // Older than anything left: start at the oldest sample.
+                stream.in_ram = false;
+                stream.page = sector;
+                stream.seq = header.first_seq;
+            }
+            break;
+        }
+        stream.in_ram = false;
+        address = sector;
+    }
+    if (stream.in_ram || stream.seq != from_seq) {
+        return SL_STATUS_OK;
+    }
+    // Then page by page within the sector.
+    stream.page = address;
+    for (uint32_t i = 0; i < PAGES_PER_SECTOR; i++, address += HISTORY_FLASH_PAGE_SIZE) {
+        if (address == head) {
+            break;
+        }
+        sc = read_header(address, &header);
+        if (sc == SL_STATUS_BUSY) {
+            return sc;
+        }
+        if (sc != SL_STATUS_OK) {
+            break;
+        }
+        stream.page = address;
+        if ((int32_t)(from_seq - (header.first_seq + header.count)) < 0) {
+            return SL_STATUS_OK;
+        }
+    }
+    // Past the last page of the sector: continue with the next one.
+    stream.page = next_page(stream.page);
+    stream.in_ram = (stream.page == head);
+    return SL_STATUS_OK;
+}
+
+static void stream_finish(void) {
+    uint8_t buf[STREAM_HEADER_SIZE];
+
+    put_u32(&buf[0], next_seq);
+    put_u16(&buf[4], boot);
+    put_u32(&buf[6], 0);
+    if (sl_bt_gatt_server_send_notification(stream.connection, gattdb_history,
+                                            sizeof(buf), buf) == SL_STATUS_NO_MORE_RESOURCE) {
+        stream_retry();
+        return;
+    }
+    LOG_INFO("History download to connection %u complete.\n", stream.connection);
+    stream.connection = CONNECTION_HANDLE_INVALID;
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t history_log_init(uint32_t signal, app_job_t *job) {
+    stream_signal = signal;
+    erase_job = job;
+    stream.connection = CONNECTION_HANDLE_INVALID;
+    page.count = 0;
+
+    sl_status_t sc = history_flash_init();
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("History flash not found: 0x%lX\n", sc);
+        return sc;
+    }
+    region_start = HISTORY_LOG_REGION_START;
+    region_end = (HISTORY_LOG_REGION_SIZE == 0)
+                 ? history_flash_size()
+                 : HISTORY_LOG_REGION_START + HISTORY_LOG_REGION_SIZE;
+    if (region_end > history_flash_size()
+        || region_end - region_start < 2 * HISTORY_FLASH_SECTOR_SIZE) {
+        return SL_STATUS_INVALID_CONFIGURATION;
+    }
+
+    find_head();
+    // Normally the sector ahead is still erased from the last boot; only
+    // erase it if a reset interrupted that erase or the region is new.
+    uint32_t ahead = sector_of(head) + HISTORY_FLASH_SECTOR_SIZE;
+    if (((head - region_start) % HISTORY_FLASH_SECTOR_SIZE) == 0) {
+        ahead = head;
+    } else if (ahead >= region_end) {
+        ahead = region_start;
+    }
+    if (sector_is_erased(ahead)) {
+        erased_sector = ahead;
+    } else {
+        erase_ahead(ahead);
+    }
+    ready = true;
+    LOG_INFO("History log: boot %u, next sample %lu.\n", boot, (unsigned long)next_seq);
+    return SL_STATUS_OK;
+}
+
+void history_log_erase_poll(void) {
+    if (history_flash_busy()) {
+        app_scheduler_post_in(erase_job, HISTORY_LOG_ERASE_POLL_MS);
+    }
+}
+
+bool history_log_is_ready(void) {
+    return ready;
+}
+
+void history_log_append(sensor_id_t sensor, uint16_t value) {
+    uint32_t now = app_clock_ms();
+
+    if (!ready) {
+        return;
+    }
+    PROFILER_BEGIN(PROFILER_ZONE_HISTORY);
+    if (page.count > 0 && now - page_last_ms > UINT16_MAX) {
+        commit_page();      // gap too long for a delta
+    }
+    if (page.count == 0) {
+        page.boot = boot;
+        page.page_seq = head_page_seq;
+        page.first_seq = next_seq;
+        page.base_ms = now;
+        page_last_ms = now;
+    }
+    uint8_t *record = &page_buf[PAGE_HEADER_SIZE + page.count * RECORD_SIZE];
+    record[0] = (uint8_t)sensor;
+    put_u16(&record[1], (uint16_t)(now - page_last_ms));
+    put_u16(&record[3], value);
+    page_last_ms = now;
+    page.count++;
+    next_seq++;
+    if (page.count == RECORDS_PER_PAGE) {
+        commit_page();
+    }
+    PROFILER_END(PROFILER_ZONE_HISTORY);
+}
+
+sl_status_t history_log_stream_start(uint8_t connection, uint32_t from_seq) {
+    if (!ready) {
+        return SL_STATUS_NOT_READY;
+    }
+    if (stream.connection != CONNECTION_HANDLE_INVALID && stream.connection != connection) {
+        return SL_STATUS_BUSY;
+    }
+    stream.connection = connection;
+    // Located by the first stream_continue(), which can wait out an erase.
+    stream.seq = from_seq;
+    stream.located = false;
+    sl_bt_external_signal(stream_signal);
+    return SL_STATUS_OK;
+}
+
+void history_log_stream_stop(uint8_t connection) {
+    if (stream.connection == connection) {
+        stream.connection = CONNECTION_HANDLE_INVALID;
+        sl_sleeptimer_stop_timer(&retry_timer);
+    }
+}
+
+uint8_t history_log_stream_connection(void) {
+    return stream.connection;
+}
+
+void history_log_stream_continue(void) {
+    uint8_t page_data[HISTORY_FLASH_PAGE_SIZE];
+    uint8_t buf[STREAM_MAX_PAYLOAD];
+    page_header_t header;
+    const connection_entry_t *entry = connection_table_find(stream.connection);
+
+    if (entry == NULL) {
+        stream.connection = CONNECTION_HANDLE_INVALID;
+        return;
+    }
+    size_t payload = entry->mtu - 3;
+    if (payload > sizeof(buf)) {
+        payload = sizeof(buf);
+    }
+    uint32_t per_notification = (payload - STREAM_HEADER_SIZE) / RECORD_SIZE;
+
+    for (int n = 0; n < HISTORY_LOG_NOTIFICATIONS_PER_PASS; n++) {
+        if (!stream.located) {
+            if (locate(stream.seq) == SL_STATUS_BUSY) {
+                stream_retry();
+                return;
+            }
+            stream.located = true;
+        }
+        if (stream.in_ram && (int32_t)(stream.seq - next_seq) >= 0) {
+            stream_finish();
+            return;
+        }
+        sl_status_t sc = load_stream_page(page_data, &header);
+        if (sc == SL_STATUS_BUSY) {
+            stream_retry();
+            return;
+        }
+        if (sc != SL_STATUS_OK
+            || (int32_t)(stream.seq - header.first_seq) < 0
+            || (int32_t)(stream.seq - (header.first_seq + header.count)) >= 0) {
+            // Overwritten or committed under our feet: find it again.
+            stream.located = false;
+            continue;
+        }
+
+        // Timestamp of the first record to send.
+        uint32_t index = stream.seq - header.first_seq;
+        uint32_t timestamp = header.base_ms;
+        for (uint32_t i = 0; i <= index; i++) {
+            timestamp += get_u16(&page_data[PAGE_HEADER_SIZE + i * RECORD_SIZE + 1]);
+        }
+        uint32_t count = header.count - index;
+        if (count > per_notification) {
+            count = per_notification;
+        }
+        put_u32(&buf[0], stream.seq);
+        put_u16(&buf[4], header.boot);
+        put_u32(&buf[6], timestamp);
+        memcpy(&buf[STREAM_HEADER_SIZE], &page_data[PAGE_HEADER_SIZE + index * RECORD_SIZE], count * RECORD_SIZE);
+        put_u16(&buf[STREAM_HEADER_SIZE + 1], 0);   // first delta is relative to base_ms
+
+        sc = sl_bt_gatt_server_send_notification(stream.connection, gattdb_history,
+                                                 STREAM_HEADER_SIZE + count * RECORD_SIZE, buf);
+        if (sc == SL_STATUS_NO_MORE_RESOURCE) {
+            stream_retry();
+            return;
+        }
+        if (sc != SL_STATUS_OK) {
+            LOG_ERROR("History download aborted: 0x%lX\n", sc);
+            stream.connection = CONNECTION_HANDLE_INVALID;
+            return;
+        }
+        stream.seq += count;
+        if (!stream.in_ram && stream.seq == header.first_seq + header.count) {
+            stream.page = next_page(stream.page);
+            stream.in_ram = (stream.page == head);
+        }
+    }
+    // Yield to the event loop, then carry on.
+    sl_bt_external_signal(stream_signal);
+}
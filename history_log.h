@@ -0,0 +1,51 @@
+#ifndef HISTORY_LOG_H
+#define HISTORY_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sl_status.h>
+#include "sensor_scheduler.h"
+#include "app_scheduler.h"
+
+// Flash layout: a circular log of 256-byte pages, one sector always kept
+// erased ahead of the write position. Each page (little-endian):
+//   uint16 magic        0x4C48
+//   uint16 boot         incremented on every boot that logs samples
+//   uint32 page_seq     monotonic page counter, locates the head on boot
+//   uint32 first_seq    sequence number of the first sample
+//   uint32 base_ms      timestamp of the first sample, ms since that boot
+//   uint8  count        records in the page, then one reserved byte
+//   records[count]      uint8 sensor id, uint16 ms since previous record,
+//                       uint16 value in the sensor characteristic's format
+//
+// History notifications replay samples from a requested sequence number:
+//   uint32 first_seq, uint16 boot, uint32 base_ms, then records as above,
+// as many as the ATT MTU allows. A notification without records ends the
+// download; its first_seq is the next sequence number to be logged.
+
+// stream_signal is posted through sl_bt_external_signal() while a download
+// is in progress; call history_log_stream_continue(). erase_job is posted
+// while a sector erase runs; its handler calls history_log_erase_poll().
+sl_status_t history_log_init(uint32_t stream_signal, app_job_t *erase_job);
+
+// Check on a running sector erase: the flash powers down once it is done.
+void history_log_erase_poll(void);
+
+bool history_log_is_ready(void);
+
+// Append one sample. Full pages are programmed to flash.
+void history_log_append(sensor_id_t sensor, uint16_t value);
+
+// Start replaying samples to a connection subscribed to History.
+// SL_STATUS_BUSY if another connection is downloading.
+sl_status_t history_log_stream_start(uint8_t connection, uint32_t from_seq);
+
+// Abort the download of a connection, if any.
+void history_log_stream_stop(uint8_t connection);
+
+void history_log_stream_continue(void);
+
+// Connection currently downloading, CONNECTION_HANDLE_INVALID if none.
+uint8_t history_log_stream_connection(void);
+
+#endif // HISTORY_LOG_H
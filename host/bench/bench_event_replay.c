@@ -0,0 +1,746 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "app.h"
+#include "gatt_db.h"
+#include "sl_bluetooth.h"
+#include "sl_iostream.h"
+#include "app_log.h"
+#include "sim.h"
+
+/**************************************************************************/
+/* Event-trace replay benchmark.                                          */
+/*                                                                        */
+/* Replays streams of sl_bt_msg_t through sl_bt_process_event() on the    */
+/* host build: the generated dispatch into OTA DFU, Device Information    */
+/* and the application's sl_bt_on_event(). Between events the virtual     */
+/* clock moves by the recorded delay and the main loop runs, so the       */
+/* events the firmware raises itself (external signals from its timers    */
+/* and jobs) are dispatched and timed too.                                */
+/*                                                                        */
+/* Each scenario replays --runs times, every run in a fresh process on a  */
+/* freshly booted firmware. The stream is deterministic, so each event is */
+/* timed as its fastest run, which keeps host preemption out of the       */
+/* worst case. Reported per scenario: events, events/s of handler time,   */
+/* mean and worst-case handling time, and heap allocations made while     */
+/* replaying (malloc, calloc and realloc are wrapped at link time).       */
+/*                                                                        */
+/* Trace files hold records of: uint16 delay in ms since the previous     */
+/* record, then the event as the stack hands it out (uint32 header,       */
+/* payload of the length the header gives), all little-endian.            */
+/**************************************************************************/
+
+#define DEFAULT_RUNS        5
+#define DEFAULT_TOLERANCE   0.3
+#define NAME_MAX_LEN        32
+#define SCENARIOS_MAX       16
+
+typedef struct {
+    uint16_t delay_ms;
+    sl_bt_msg_t msg;
+} trace_record_t;
+
+typedef struct {
+    char name[NAME_MAX_LEN];
+    trace_record_t *records;
+    size_t count;
+    size_t capacity;
+    uint32_t duration_ms;
+} trace_t;
+
+typedef struct {
+    uint32_t events;
+    uint32_t allocations;
+} run_header_t;
+
+typedef struct {
+    uint32_t *ns;
+    uint32_t *ids;
+    uint32_t events;
+    uint32_t capacity;
+} recording_t;
+
+typedef struct {
+    char name[NAME_MAX_LEN];
+    uint32_t events;
+    double events_per_s;
+    double mean_ns;
+    double max_ns;
+    uint32_t max_id;
+    uint32_t allocations;
+} result_t;
+
+typedef struct {
+    char name[NAME_MAX_LEN];
+    uint32_t events;
+    double events_per_s;
+    double max_ns;
+    uint32_t allocations;
+} baseline_t;
+
+/**************************************************************************/
+/* Allocation Counting                                                    */
+/**************************************************************************/
+static uint32_t allocations = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    allocations++;
+    return __real_realloc(ptr, size);
+}
+
+/**************************************************************************/
+/* Traces                                                                 */
+/**************************************************************************/
+static trace_record_t *trace_add(trace_t *trace, uint16_t delay_ms, uint32_t id) {
+    trace_record_t *record;
+
+    if (trace->count == trace->capacity) {
+        trace->capacity = trace->capacity ? 2 * trace->capacity : 1024;
+        trace->records = realloc(trace->records, trace->capacity * sizeof(trace_record_t));
+        if (trace->records == NULL) {
+            fprintf(stderr, "bench_event_replay: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    record = &trace->records[trace->count++];
+    memset(record, 0, sizeof(*record));
+    record->delay_ms = delay_ms;
+    record->msg.header = id;
+    trace->duration_ms += delay_ms;
+    return record;
+}
+
+static void add_opened(trace_t *trace, uint16_t delay_ms, uint8_t connection) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_connection_opened_id)->msg;
+
+    msg->data.evt_connection_opened.connection = connection;
+    msg->data.evt_connection_opened.address.addr[0] = connection;
+}
+
+static void add_closed(trace_t *trace, uint16_t delay_ms, uint8_t connection) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_connection_closed_id)->msg;
+
+    msg->data.evt_connection_closed.connection = connection;
+    msg->data.evt_connection_closed.reason = 0x13;      // remote user terminated
+}
+
+static void add_parameters(trace_t *trace, uint16_t delay_ms, uint8_t connection, uint16_t interval) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_connection_parameters_id)->msg;
+
+    msg->data.evt_connection_parameters.connection = connection;
+    msg->data.evt_connection_parameters.interval = interval;
+    msg->data.evt_connection_parameters.timeout = 500;
+}
+
+static void add_phy(trace_t *trace, uint16_t delay_ms, uint8_t connection, uint8_t phy) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_connection_phy_status_id)->msg;
+
+    msg->data.evt_connection_phy_status.connection = connection;
+    msg->data.evt_connection_phy_status.phy = phy;
+}
+
+static void add_mtu(trace_t *trace, uint16_t delay_ms, uint8_t connection, uint16_t mtu) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_gatt_mtu_exchanged_id)->msg;
+
+    msg->data.evt_gatt_mtu_exchanged.connection = connection;
+    msg->data.evt_gatt_mtu_exchanged.mtu = mtu;
+}
+
+static void add_cccd(trace_t *trace, uint16_t delay_ms, uint8_t connection, uint16_t characteristic, bool enable) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_gatt_server_characteristic_status_id)->msg;
+
+    msg->data.evt_gatt_server_characteristic_status.connection = connection;
+    msg->data.evt_gatt_server_characteristic_status.characteristic = characteristic;
+    msg->data.evt_gatt_server_characteristic_status.status_flags = sl_bt_gatt_server_client_config;
+    msg->data.evt_gatt_server_characteristic_status.client_config_flags = enable ? gatt_notification : gatt_disable;
+}
+
+static void add_read(trace_t *trace, uint16_t delay_ms, uint8_t connection, uint16_t characteristic) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_gatt_server_user_read_request_id)->msg;
+
+    msg->data.evt_gatt_server_user_read_request.connection = connection;
+    msg->data.evt_gatt_server_user_read_request.characteristic = characteristic;
+}
+
+static void add_write(trace_t *trace, uint16_t delay_ms, uint8_t connection, uint16_t characteristic,
+                      const uint8_t *data, uint8_t len) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_gatt_server_user_write_request_id)->msg;
+
+    msg->data.evt_gatt_server_user_write_request.connection = connection;
+    msg->data.evt_gatt_server_user_write_request.characteristic = characteristic;
+    msg->data.evt_gatt_server_user_write_request.att_opcode = sl_bt_gatt_write_request;
+    msg->data.evt_gatt_server_user_write_request.value.len = len;
+    memcpy(msg->data.evt_gatt_server_user_write_request.value.data, data, len);
+}
+
+static void add_signal(trace_t *trace, uint16_t delay_ms, uint32_t signals) {
+    sl_bt_msg_t *msg = &trace_add(trace, delay_ms, sl_bt_evt_system_external_signal_id)->msg;
+
+    msg->data.evt_system_external_signal.extsignals = signals;
+}
+
+// Fixed-seed generator, so every run builds the same streams.
+static uint32_t random_state;
+
+static uint32_t random_next(uint32_t range) {
+    random_state = random_state * 1664525UL + 1013904223UL;
+    return (random_state >> 16) % range;
+}
+
+/**************************************************************************/
+/* Synthetic Scenarios                                                    */
+/**************************************************************************/
+// Connection churn: open, parameter, PHY and MTU updates, subscriptions,
+// close, on the four connection handles in turn.
+static void generate_connections(trace_t *trace, uint32_t scale) {
+    for (uint32_t i = 0; i < 1000 * scale; i++) {
+        uint8_t connection = (uint8_t)(1 + i % 4);
+
+        add_opened(trace, 5, connection);
+        add_parameters(trace, 1, connection, (uint16_t)(24 + random_next(16)));
+        add_phy(trace, 1, connection, 2);
+        add_mtu(trace, 1, connection, 247);
+        add_cccd(trace, 1, connection, gattdb_temperature, true);
+        add_cccd(trace, 1, connection, gattdb_humidity_0, true);
+        add_cccd(trace, 50, connection, gattdb_temperature, false);
+        add_closed(trace, 1, connection);
+    }
+}
+
+// One link toggling CCCDs and reading and writing characteristics a few
+// milliseconds apart.
+static void generate_cccd(trace_t *trace, uint32_t scale) {
+    static const uint16_t subscribable[] = {
+        gattdb_temperature, gattdb_humidity_0, gattdb_irradiance_0,
+        gattdb_batched_samples, gattdb_link_diagnostics
+    };
+    static const uint16_t readable[] = {
+        gattdb_measurement_interval, gattdb_link_diagnostics,
+        gattdb_power_diagnostics, gattdb_temperature
+    };
+
+    add_opened(trace, 1, 1);
+    add_mtu(trace, 1, 1, 247);
+    for (uint32_t i = 0; i < 8000 * scale; i++) {
+        uint16_t delay_ms = (uint16_t)(1 + random_next(3));
+
+        switch (random_next(4)) {
+        case 0:
+        case 1:
+            add_cccd(trace, delay_ms, 1,
+                     subscribable[random_next(sizeof(subscribable) / sizeof(subscribable[0]))],
+                     random_next(2) != 0);
+            break;
+        case 2:
+            add_read(trace, delay_ms, 1, readable[random_next(sizeof(readable) / sizeof(readable[0]))]);
+            break;
+        default: {
+            uint8_t interval[2] = { (uint8_t)(1 + random_next(10)), 0 };
+            add_write(trace, delay_ms, 1, gattdb_measurement_interval, interval, sizeof(interval));
+            break;
+        }
+        }
+    }
+    add_closed(trace, 1, 1);
+}
+
+// External signals at 1 kHz on a link subscribed to every sensor. Each
+// signal carries one of the low eight bits, which covers every signal
+// app_init() allocates.
+static void generate_signals(trace_t *trace, uint32_t scale) {
+    add_opened(trace, 1, 1);
+    add_mtu(trace, 1, 1, 247);
+    add_cccd(trace, 1, 1, gattdb_temperature, true);
+    add_cccd(trace, 1, 1, gattdb_humidity_0, true);
+    add_cccd(trace, 1, 1, gattdb_irradiance_0, true);
+    for (uint32_t i = 0; i < 8000 * scale; i++) {
+        add_signal(trace, 1, 1UL << (i % 8));
+    }
+    add_closed(trace, 1, 1);
+}
+
+static void generate(trace_t *trace, const char *name, void (*generator)(trace_t *, uint32_t), uint32_t scale) {
+    memset(trace, 0, sizeof(*trace));
+    snprintf(trace->name, sizeof(trace->name), "%s", name);
+    random_state = 12345;
+    generator(trace, scale);
+}
+
+/**************************************************************************/
+/* Trace Files                                                            */
+/**************************************************************************/
+static size_t payload_len(uint32_t header) {
+    return SL_BT_MSG_LEN(header);
+}
+
+static bool trace_write(const trace_t *trace, const char *path) {
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < trace->count; i++) {
+        const trace_record_t *record = &trace->records[i];
+        sl_bt_msg_t msg = record->msg;
+        size_t len = sim_bt_payload_len(&msg);
+        uint8_t head[6];
+
+        msg.header = SL_BT_MSG_ID(msg.header) | ((len & 0xFF) << 8) | ((len >> 8) & 0x7);
+        head[0] = record->delay_ms & 0xFF;
+        head[1] = record->delay_ms >> 8;
+        for (int b = 0; b < 4; b++) {
+            head[2 + b] = (msg.header >> (8 * b)) & 0xFF;
+        }
+        fwrite(head, 1, sizeof(head), file);
+        fwrite(msg.data.payload, 1, len, file);
+    }
+    return fclose(file) == 0;
+}
+
+static bool trace_read(trace_t *trace, const char *path) {
+    FILE *file = fopen(path, "rb");
+    const char *base = strrchr(path, '/');
+    uint8_t head[6];
+
+    if (file == NULL) {
+        return false;
+    }
+    memset(trace, 0, sizeof(*trace));
+    snprintf(trace->name, sizeof(trace->name), "%s", base ? base + 1 : path);
+    trace->name[strcspn(trace->name, ".")] = '\0';
+    while (fread(head, 1, sizeof(head), file) == sizeof(head)) {
+        uint32_t header = head[2] | (head[3] << 8) | ((uint32_t)head[4] << 16) | ((uint32_t)head[5] << 24);
+        trace_record_t *record = trace_add(trace, (uint16_t)(head[0] | (head[1] << 8)), header);
+        size_t len = payload_len(header);
+
+        if (len > sizeof(record->msg.data) || fread(record->msg.data.payload, 1, len, file) != len) {
+            fclose(file);
+            return false;
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+/**************************************************************************/
+/* Replay                                                                 */
+/**************************************************************************/
+static sl_status_t discard_write(void *context, const void *buffer, size_t length) {
+    (void)context;
+    (void)buffer;
+    (void)length;
+    return SL_STATUS_OK;
+}
+
+// Logging stays on, so the handlers format their messages as on target,
+// but the text goes nowhere.
+static sl_iostream_t discard_stream = { .write = discard_write };
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Where the wrapped sl_bt_step() records, NULL while not replaying.
+static recording_t *recording = NULL;
+
+void __real_sl_bt_step(void);
+
+// sim_run_until() runs the main loop with sl_bt_step() from
+// autogen/sl_bluetooth.c; this is the same step with the dispatch timed.
+void __wrap_sl_bt_step(void) {
+    sl_bt_msg_t evt;
+    uint32_t event_len;
+    uint64_t start;
+    uint64_t elapsed;
+
+    if (recording == NULL) {
+        __real_sl_bt_step();
+        return;
+    }
+    sl_bt_run();
+    event_len = sl_bt_event_pending_len();
+    if (event_len == 0 || !sl_bt_can_process_event(event_len)
+        || sl_bt_pop_event(&evt) != SL_STATUS_OK) {
+        return;
+    }
+    start = now_ns();
+    sl_bt_process_event(&evt);
+    elapsed = now_ns() - start;
+    if (recording->events < recording->capacity) {
+        recording->ns[recording->events] = (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+        recording->ids[recording->events] = SL_BT_MSG_ID(evt.header);
+    }
+    recording->events++;
+}
+
+static void replay(const trace_t *trace, uint32_t *ns, uint32_t *ids, run_header_t *header, uint32_t capacity) {
+    static recording_t record;
+
+    sim_log_enable(false);
+    sim_boot();
+    sl_iostream_set_default_stream(&discard_stream);
+    sim_log_enable(true);
+
+    record.ns = ns;
+    record.ids = ids;
+    record.events = 0;
+    record.capacity = capacity;
+    recording = &record;
+    allocations = 0;
+    for (size_t i = 0; i < trace->count; i++) {
+        const sl_bt_msg_t *msg = &trace->records[i].msg;
+
+        sim_run_ms(trace->records[i].delay_ms);
+        if (SL_BT_MSG_ID(msg->header) == sl_bt_evt_system_external_signal_id) {
+            // Signals merge into one pending event, as in the stack.
+            sl_bt_external_signal(msg->data.evt_system_external_signal.extsignals);
+        } else {
+            sim_bt_push(msg);
+        }
+        sim_run_idle();
+    }
+    recording = NULL;
+    header->events = record.events;
+    header->allocations = allocations;
+}
+
+static bool write_all(int fd, const void *data, size_t len) {
+    const uint8_t *bytes = data;
+
+    while (len > 0) {
+        ssize_t n = write(fd, bytes, len);
+        if (n <= 0) {
+            return false;
+        }
+        bytes += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static bool read_all(int fd, void *data, size_t len) {
+    uint8_t *bytes = data;
+
+    while (len > 0) {
+        ssize_t n = read(fd, bytes, len);
+        if (n <= 0) {
+            return false;
+        }
+        bytes += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+// One run in a child process, so every run starts from a cold firmware.
+static bool run_once(const trace_t *trace, uint32_t *ns, uint32_t *ids, run_header_t *header, uint32_t capacity) {
+    int fds[2];
+    pid_t pid;
+    int status;
+    bool ok;
+
+    fflush(stdout);
+    if (pipe(fds) != 0 || (pid = fork()) < 0) {
+        return false;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        replay(trace, ns, ids, header, capacity);
+        ok = write_all(fds[1], header, sizeof(*header))
+             && header->events <= capacity
+             && write_all(fds[1], ns, header->events * sizeof(ns[0]))
+             && write_all(fds[1], ids, header->events * sizeof(ids[0]));
+        _exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    close(fds[1]);
+    ok = read_all(fds[0], header, sizeof(*header))
+         && header->events <= capacity
+         && read_all(fds[0], ns, header->events * sizeof(ns[0]))
+         && read_all(fds[0], ids, header->events * sizeof(ids[0]));
+    close(fds[0]);
+    waitpid(pid, &status, 0);
+    return ok && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+}
+
+static bool measure(const trace_t *trace, uint32_t runs, result_t *result) {
+    // Room for the trace and a self-raised event per virtual millisecond.
+    uint32_t capacity = (uint32_t)trace->count + trace->duration_ms + 1024;
+    uint32_t *ns = malloc(capacity * sizeof(uint32_t));
+    uint32_t *ids = malloc(capacity * sizeof(uint32_t));
+    uint32_t *best = malloc(capacity * sizeof(uint32_t));
+    uint32_t *best_ids = malloc(capacity * sizeof(uint32_t));
+    run_header_t header;
+    run_header_t first = { 0 };
+    bool ok = (ns != NULL && ids != NULL && best != NULL && best_ids != NULL);
+
+    for (uint32_t run = 0; ok && run < runs; run++) {
+        ok = run_once(trace, ns, ids, &header, capacity);
+        if (!ok) {
+            fprintf(stderr, "bench_event_replay: %s: replay failed\n", trace->name);
+        } else if (run == 0) {
+            first = header;
+            memcpy(best, ns, header.events * sizeof(uint32_t));
+            memcpy(best_ids, ids, header.events * sizeof(uint32_t));
+        } else if (header.events != first.events
+                   || memcmp(ids, best_ids, header.events * sizeof(uint32_t)) != 0) {
+            fprintf(stderr, "bench_event_replay: %s: replay is not deterministic\n", trace->name);
+            ok = false;
+        } else {
+            for (uint32_t i = 0; i < header.events; i++) {
+                if (ns[i] < best[i]) {
+                    best[i] = ns[i];
+                }
+            }
+        }
+    }
+
+    if (ok) {
+        uint64_t total = 0;
+
+        memset(result, 0, sizeof(*result));
+        snprintf(result->name, sizeof(result->name), "%s", trace->name);
+        result->events = first.events;
+        result->allocations = first.allocations;
+        for (uint32_t i = 0; i < first.events; i++) {
+            total += best[i];
+            if (best[i] > result->max_ns) {
+                result->max_ns = best[i];
+                result->max_id = best_ids[i];
+            }
+        }
+        result->mean_ns = first.events ? (double)total / first.events : 0;
+        result->events_per_s = total ? first.events * 1e9 / (double)total : 0;
+    }
+    free(ns);
+    free(ids);
+    free(best);
+    free(best_ids);
+    return ok;
+}
+
+/**************************************************************************/
+/* Baseline                                                               */
+/**************************************************************************/
+static const char *event_name(uint32_t id) {
+    switch (id) {
+    case sl_bt_evt_system_boot_id: return "boot";
+    case sl_bt_evt_system_external_signal_id: return "ext_signal";
+    case sl_bt_evt_connection_opened_id: return "conn_opened";
+    case sl_bt_evt_connection_parameters_id: return "conn_params";
+    case sl_bt_evt_connection_phy_status_id: return "phy_status";
+    case sl_bt_evt_connection_closed_id: return "conn_closed";
+    case sl_bt_evt_gatt_mtu_exchanged_id: return "mtu";
+    case sl_bt_evt_gatt_server_user_read_request_id: return "user_read";
+    case sl_bt_evt_gatt_server_user_write_request_id: return "user_write";
+    case sl_bt_evt_gatt_server_characteristic_status_id: return "char_status";
+    default: return "other";
+    }
+}
+
+static size_t baseline_read(const char *path, baseline_t *entries, size_t max) {
+    FILE *file = fopen(path, "r");
+    char line[256];
+    size_t count = 0;
+
+    if (file == NULL) {
+        return 0;
+    }
+    while (count < max && fgets(line, sizeof(line), file) != NULL) {
+        baseline_t *entry = &entries[count];
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if (sscanf(line, "%31s %u %lf %lf %u", entry->name, &entry->events, &entry->events_per_s,
+                   &entry->max_ns, &entry->allocations) == 5) {
+            count++;
+        }
+    }
+    fclose(file);
+    return count;
+}
+
+static bool baseline_write(const char *path, const result_t *results, size_t count, uint32_t runs) {
+    FILE *file = fopen(path, "w");
+
+    if (file == NULL) {
+        return false;
+    }
+    fprintf(file, "# bench_event_replay baseline (host/bench/bench_event_replay.c), %u runs.\n", runs);
+    fprintf(file, "# events must match and allocs must not grow; events/s and max_ns are\n");
+    fprintf(file, "# machine-dependent and only enforced with --strict. Regenerate with\n");
+    fprintf(file, "#   bench_event_replay --write-baseline host/bench/baseline.txt\n");
+    fprintf(file, "# scenario     events   events_per_s     max_ns  allocs\n");
+    for (size_t i = 0; i < count; i++) {
+        fprintf(file, "%-12s %8u %14.0f %10.0f %7u\n",
+                results[i].name, results[i].events, results[i].events_per_s,
+                results[i].max_ns, results[i].allocations);
+    }
+    return fclose(file) == 0;
+}
+
+// Returns false on a regression that fails the run.
+static bool baseline_check(const result_t *result, const baseline_t *entries, size_t count,
+                           double tolerance, bool strict) {
+    const baseline_t *entry = NULL;
+    bool ok = true;
+
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(entries[i].name, result->name) == 0) {
+            entry = &entries[i];
+        }
+    }
+    if (entry == NULL) {
+        printf("  %s: not in the baseline\n", result->name);
+        return true;
+    }
+    if (result->events != entry->events) {
+        printf("  %s: FAIL %u events, baseline %u: the firmware reacts differently; regenerate the baseline\n",
+               result->name, result->events, entry->events);
+        ok = false;
+    }
+    if (result->allocations > entry->allocations) {
+        printf("  %s: FAIL %u allocations, baseline %u\n", result->name, result->allocations, entry->allocations);
+        ok = false;
+    }
+    if (result->events_per_s < entry->events_per_s * (1.0 - tolerance)) {
+        printf("  %s: %s %.0f events/s, baseline %.0f\n", result->name,
+               strict ? "FAIL" : "warning:", result->events_per_s, entry->events_per_s);
+        ok = ok && !strict;
+    }
+    if (result->max_ns > entry->max_ns * (1.0 + tolerance)) {
+        printf("  %s: %s worst case %.0f ns, baseline %.0f\n", result->name,
+               strict ? "FAIL" : "warning:", result->max_ns, entry->max_ns);
+        ok = ok && !strict;
+    }
+    return ok;
+}
+
+/**************************************************************************/
+/* Main                                                                   */
+/**************************************************************************/
+static void usage(void) {
+    fprintf(stderr,
+            "usage: bench_event_replay [--runs N] [--scale N] [--baseline FILE [--strict] [--tolerance F]]\n"
+            "                          [--write-baseline FILE] [--write-traces DIR] [TRACE...]\n"
+            "Without TRACE files the synthetic scenarios are replayed.\n");
+}
+
+int main(int argc, char **argv) {
+    static trace_t traces[SCENARIOS_MAX];
+    static result_t results[SCENARIOS_MAX];
+    static baseline_t baseline[SCENARIOS_MAX];
+    const char *baseline_path = NULL;
+    const char *write_baseline_path = NULL;
+    const char *traces_dir = NULL;
+    uint32_t runs = DEFAULT_RUNS;
+    uint32_t scale = 1;
+    double tolerance = DEFAULT_TOLERANCE;
+    bool strict = false;
+    size_t count = 0;
+    size_t baseline_count = 0;
+    bool ok = true;
+    int arg;
+
+    for (arg = 1; arg < argc && argv[arg][0] == '-'; arg++) {
+        if (strcmp(argv[arg], "--runs") == 0 && arg + 1 < argc) {
+            runs = (uint32_t)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--scale") == 0 && arg + 1 < argc) {
+            scale = (uint32_t)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--baseline") == 0 && arg + 1 < argc) {
+            baseline_path = argv[++arg];
+        } else if (strcmp(argv[arg], "--tolerance") == 0 && arg + 1 < argc) {
+            tolerance = atof(argv[++arg]);
+        } else if (strcmp(argv[arg], "--strict") == 0) {
+            strict = true;
+        } else if (strcmp(argv[arg], "--write-baseline") == 0 && arg + 1 < argc) {
+            write_baseline_path = argv[++arg];
+        } else if (strcmp(argv[arg], "--write-traces") == 0 && arg + 1 < argc) {
+            traces_dir = argv[++arg];
+        } else {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (runs == 0 || scale == 0) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    if (arg < argc) {
+        for (; arg < argc && count < SCENARIOS_MAX; arg++) {
+            if (!trace_read(&traces[count], argv[arg])) {
+                fprintf(stderr, "bench_event_replay: cannot read trace %s\n", argv[arg]);
+                return EXIT_FAILURE;
+            }
+            count++;
+        }
+    } else {
+        generate(&traces[count++], "connections", generate_connections, scale);
+        generate(&traces[count++], "cccd", generate_cccd, scale);
+        generate(&traces[count++], "signals", generate_signals, scale);
+    }
+
+    if (traces_dir != NULL) {
+        for (size_t i = 0; i < count; i++) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/%s.trace", traces_dir, traces[i].name);
+            if (!trace_write(&traces[i], path)) {
+                fprintf(stderr, "bench_event_replay: cannot write %s\n", path);
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    if (baseline_path != NULL) {
+        baseline_count = baseline_read(baseline_path, baseline, SCENARIOS_MAX);
+        if (baseline_count == 0) {
+            fprintf(stderr, "bench_event_replay: no baseline in %s\n", baseline_path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("%-12s %8s %12s %10s %10s  %-12s %7s\n",
+           "scenario", "events", "events/s", "mean ns", "max ns", "worst", "allocs");
+    for (size_t i = 0; i < count; i++) {
+        if (!measure(&traces[i], runs, &results[i])) {
+            return EXIT_FAILURE;
+        }
+        printf("%-12s %8u %12.0f %10.0f %10.0f  %-12s %7u\n",
+               results[i].name, results[i].events, results[i].events_per_s, results[i].mean_ns,
+               results[i].max_ns, event_name(results[i].max_id), results[i].allocations);
+    }
+    for (size_t i = 0; i < count && baseline_path != NULL; i++) {
+        ok = baseline_check(&results[i], baseline, baseline_count, tolerance, strict) && ok;
+    }
+    if (write_baseline_path != NULL && !baseline_write(write_baseline_path, results, count, runs)) {
+        fprintf(stderr, "bench_event_replay: cannot write %s\n", write_baseline_path);
+        return EXIT_FAILURE;
+    }
+    for (size_t i = 0; i < count; i++) {
+        free(traces[i].records);
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,20 @@
+// Host stand-in for the GSDK app_assert.h: a failed assertion aborts.
+#ifndef APP_ASSERT_H
+#define APP_ASSERT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "sl_status.h"
+
+#define app_assert(expr, ...)                                               \
+    do {                                                                    \
+        if (!(expr)) {                                                      \
+            fprintf(stderr, "%s:%d: assertion '%s' failed\n",               \
+                    __FILE__, __LINE__, #expr);                             \
+            abort();                                                        \
+        }                                                                   \
+    } while (0)
+#define app_assert_status(sc)           app_assert((sc) == SL_STATUS_OK)
+#define app_assert_status_f(sc, ...)    app_assert((sc) == SL_STATUS_OK)
+
+#endif // APP_ASSERT_H
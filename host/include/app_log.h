@@ -0,0 +1,24 @@
+// Host stand-in for the GSDK app_log.h. Output goes to stdout through
+// sim_log() unless a test turns it off.
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#include <stdbool.h>
+
+#define APP_LOG_LEVEL_DEBUG     0
+#define APP_LOG_LEVEL_INFO      1
+#define APP_LOG_LEVEL_WARNING   2
+#define APP_LOG_LEVEL_ERROR     3
+#define APP_LOG_LEVEL_CRITICAL  4
+
+void sim_log(const char *format, ...);
+void sim_log_enable(bool enable);
+
+#define app_log(...)            sim_log(__VA_ARGS__)
+#define app_log_debug(...)      sim_log(__VA_ARGS__)
+#define app_log_info(...)       sim_log(__VA_ARGS__)
+#define app_log_warning(...)    sim_log(__VA_ARGS__)
+#define app_log_error(...)      sim_log(__VA_ARGS__)
+#define app_log_critical(...)   sim_log(__VA_ARGS__)
+
+#endif // APP_LOG_H
@@ -0,0 +1,11 @@
+// Host stand-in for the GSDK app_timer.h: the power manager hooks only.
+#ifndef APP_TIMER_H
+#define APP_TIMER_H
+
+#include <stdbool.h>
+#include "sl_power_manager.h"
+
+bool sli_app_timer_is_ok_to_sleep(void);
+sl_power_manager_on_isr_exit_t sli_app_timer_sleep_on_isr_exit(void);
+
+#endif // APP_TIMER_H
@@ -0,0 +1,16 @@
+// Host stand-in for the GSDK em_cmu.h.
+#ifndef EM_CMU_H
+#define EM_CMU_H
+
+#include <stdbool.h>
+
+typedef enum {
+    cmuClock_GPIO,
+    cmuClock_LDMA,
+    cmuClock_USART0,
+    cmuClock_USART2
+} CMU_Clock_TypeDef;
+
+void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable);
+
+#endif // EM_CMU_H
@@ -0,0 +1,15 @@
+// Host stand-in for the GSDK em_common.h.
+#ifndef EM_COMMON_H
+#define EM_COMMON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SL_WEAK                 __attribute__((weak))
+#define __WEAK                  __attribute__((weak))
+#define SL_ATTRIBUTE_PACKED     __attribute__((packed))
+#define SL_MIN(a, b)            ((a) < (b) ? (a) : (b))
+#define SL_MAX(a, b)            ((a) > (b) ? (a) : (b))
+#define EFM_ASSERT(expr)        ((void)(expr))
+
+#endif // EM_COMMON_H
@@ -0,0 +1,36 @@
+// Host stand-in for the GSDK em_core.h. Interrupt masking is modelled by
+// the simulator: a nesting count in the single-threaded host build, a
+// process-wide lock in the POSIX port (host/posix).
+#ifndef EM_CORE_H
+#define EM_CORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "em_common.h"
+
+typedef uint32_t CORE_irqState_t;
+
+CORE_irqState_t sim_core_enter(void);
+void sim_core_exit(CORE_irqState_t state);
+
+#define CORE_DECLARE_IRQ_STATE          CORE_irqState_t irqState
+#define CORE_ENTER_CRITICAL()           irqState = sim_core_enter()
+#define CORE_EXIT_CRITICAL()            sim_core_exit(irqState)
+#define CORE_ENTER_ATOMIC()             irqState = sim_core_enter()
+#define CORE_EXIT_ATOMIC()              sim_core_exit(irqState)
+
+#define CORE_CRITICAL_SECTION(yourcode) \
+    {                                   \
+        CORE_DECLARE_IRQ_STATE;         \
+        CORE_ENTER_CRITICAL();          \
+        {                               \
+            yourcode                    \
+        }                               \
+        CORE_EXIT_CRITICAL();           \
+    }
+#define CORE_ATOMIC_SECTION(yourcode)   CORE_CRITICAL_SECTION(yourcode)
+
+bool CORE_InIrqContext(void);
+bool CORE_IrqIsDisabled(void);
+
+#endif // EM_CORE_H
@@ -0,0 +1,77 @@
+// Host stand-in for the GSDK em_device.h: the core registers the
+// application touches, backed by memory in host/sim/sim_platform.c.
+// DWT->CYCCNT follows the virtual clock at SystemCoreClockGet() Hz.
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef union {
+    volatile uint8_t u8;
+    volatile uint16_t u16;
+    volatile uint32_t u32;
+} ITM_Port_t;
+
+typedef struct {
+    ITM_Port_t PORT[32];
+    volatile uint32_t TER;
+    volatile uint32_t TCR;
+} ITM_Type;
+
+typedef struct {
+    volatile uint32_t ISER[8];
+    volatile uint32_t ICER[8];
+    volatile uint32_t ISPR[8];
+    volatile uint32_t ICPR[8];
+} NVIC_Type;
+
+extern CoreDebug_Type sim_core_debug;
+extern DWT_Type sim_dwt;
+extern ITM_Type sim_itm;
+extern NVIC_Type sim_nvic;
+
+#define CoreDebug                   (&sim_core_debug)
+#define DWT                         (&sim_dwt)
+#define ITM                         (&sim_itm)
+#define NVIC                        (&sim_nvic)
+
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define ITM_TCR_ITMENA_Msk          (1UL << 0)
+
+// EFR32MG12 interrupt numbers the simulator raises, and PendSV, which
+// the generated sl_bluetooth.c enables.
+#define PendSV_IRQn                 (-2)
+#define RTCC_IRQn                   30
+
+// CMSIS NVIC access for device interrupts; system exceptions are ignored.
+static inline void NVIC_EnableIRQ(int irq) {
+    if (irq >= 0) {
+        NVIC->ISER[irq >> 5] |= 1UL << (irq & 31);
+    }
+}
+
+static inline void NVIC_DisableIRQ(int irq) {
+    if (irq >= 0) {
+        NVIC->ISER[irq >> 5] &= ~(1UL << (irq & 31));
+    }
+}
+
+static inline void NVIC_ClearPendingIRQ(int irq) {
+    if (irq >= 0) {
+        NVIC->ISPR[irq >> 5] &= ~(1UL << (irq & 31));
+    }
+}
+
+uint32_t SystemCoreClockGet(void);
+
+#endif // EM_DEVICE_H
@@ -0,0 +1,29 @@
+// Host stand-in for the GSDK em_gpio.h. Pin levels are kept by the
+// simulator, see sim_gpio_get().
+#ifndef EM_GPIO_H
+#define EM_GPIO_H
+
+#include <stdint.h>
+
+typedef enum {
+    gpioPortA = 0,
+    gpioPortB = 1,
+    gpioPortC = 2,
+    gpioPortD = 3,
+    gpioPortF = 5,
+    gpioPortI = 8,
+    gpioPortJ = 9,
+    gpioPortK = 10
+} GPIO_Port_TypeDef;
+
+typedef enum {
+    gpioModeDisabled,
+    gpioModeInput,
+    gpioModePushPull
+} GPIO_Mode_TypeDef;
+
+void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin, GPIO_Mode_TypeDef mode, unsigned int out);
+void GPIO_PinOutSet(GPIO_Port_TypeDef port, unsigned int pin);
+void GPIO_PinOutClear(GPIO_Port_TypeDef port, unsigned int pin);
+
+#endif // EM_GPIO_H
@@ -0,0 +1,7 @@
+// Host stand-in for the GSDK sl_assert.h. EFM_ASSERT is in em_common.h.
+#ifndef SL_ASSERT_H
+#define SL_ASSERT_H
+
+#include "em_common.h"
+
+#endif // SL_ASSERT_H
@@ -0,0 +1,278 @@
+// Host stand-in for the GSDK sl_bt_api.h: the events and commands the
+// application uses, with the SDK's message IDs and packed layouts.
+#ifndef SL_BT_API_H
+#define SL_BT_API_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sl_status.h"
+
+#define SL_BT_MSG_ID(HDR)       ((HDR) & 0xffff00f8)
+#define SL_BT_MSG_LEN(HDR)      ((((HDR) & 0x7) << 8) | (((HDR) & 0xff00) >> 8))
+#define SL_BT_MSG_HEADER_LEN    (4)
+
+#define PACKSTRUCT(decl)        decl __attribute__((packed))
+
+PACKSTRUCT(struct bd_addr {
+    uint8_t addr[6];
+});
+typedef struct bd_addr bd_addr;
+
+PACKSTRUCT(struct byte_array {
+    uint8_t len;
+    uint8_t data[];
+});
+typedef struct byte_array uint8array;
+
+#define SL_BT_INVALID_CONNECTION_HANDLE         ((uint8_t)0xFF)
+#define SL_BT_INVALID_ADVERTISING_SET_HANDLE    ((uint8_t)0xFF)
+
+/**************************************************************************/
+/* Enumerations                                                           */
+/**************************************************************************/
+typedef enum {
+    gatt_disable      = 0x0,
+    gatt_notification = 0x1,
+    gatt_indication   = 0x2
+} sl_bt_gatt_client_config_flag_t;
+
+typedef enum {
+    sl_bt_gatt_server_client_config = 0x1,
+    sl_bt_gatt_server_confirmation  = 0x2
+} sl_bt_gatt_server_characteristic_status_flag_t;
+
+typedef enum {
+    sl_bt_gatt_write_request          = 0x12,
+    sl_bt_gatt_write_command          = 0x52,
+    sl_bt_gatt_execute_write_request  = 0x18
+} sl_bt_gatt_att_opcode_t;
+
+typedef enum {
+    sl_bt_att_errcode_request_not_supported  = 0x6,
+    sl_bt_att_errcode_invalid_offset         = 0x7,
+    sl_bt_att_errcode_invalid_att_length     = 0xd,
+    sl_bt_att_errcode_unlikely_error         = 0xe,
+    sl_bt_att_errcode_insufficient_resources = 0x11,
+    sl_bt_att_errcode_value_not_allowed      = 0x13
+} sl_bt_att_errcode_t;
+
+typedef enum {
+    sl_bt_advertiser_advertising_data_packet = 0x0,
+    sl_bt_advertiser_scan_response_packet    = 0x1
+} sl_bt_advertiser_packet_type_t;
+
+typedef enum {
+    sl_bt_advertiser_non_discoverable     = 0x0,
+    sl_bt_advertiser_limited_discoverable = 0x1,
+    sl_bt_advertiser_general_discoverable = 0x2
+} sl_bt_advertiser_discovery_mode_t;
+
+typedef enum {
+    sl_bt_legacy_advertiser_non_connectable = 0x0,
+    sl_bt_legacy_advertiser_connectable     = 0x2,
+    sl_bt_legacy_advertiser_scannable       = 0x3
+} sl_bt_legacy_advertiser_connection_mode_t;
+
+typedef enum {
+    sl_bt_gap_phy_1m    = 0x1,
+    sl_bt_gap_phy_2m    = 0x2,
+    sl_bt_gap_phy_coded = 0x4,
+    sl_bt_gap_phy_any   = 0xff
+} sl_bt_gap_phy_t;
+
+#define SL_BT_PERIODIC_ADVERTISER_INCLUDE_TX_POWER                  0x1
+#define SL_BT_PERIODIC_ADVERTISER_AUTO_START_EXTENDED_ADVERTISING   0x2
+
+/**************************************************************************/
+/* Events                                                                 */
+/**************************************************************************/
+#define sl_bt_evt_system_boot_id                        0x000100a0
+#define sl_bt_evt_system_external_signal_id             0x030100a0
+#define sl_bt_evt_connection_opened_id                  0x000600a0
+#define sl_bt_evt_connection_parameters_id              0x020600a0
+#define sl_bt_evt_connection_phy_status_id              0x040600a0
+#define sl_bt_evt_connection_closed_id                  0x010600a0
+#define sl_bt_evt_gatt_mtu_exchanged_id                 0x000900a0
+#define sl_bt_evt_gatt_server_attribute_value_id        0x000a00a0
+#define sl_bt_evt_gatt_server_user_read_request_id      0x010a00a0
+#define sl_bt_evt_gatt_server_user_write_request_id     0x020a00a0
+#define sl_bt_evt_gatt_server_characteristic_status_id  0x030a00a0
+
+PACKSTRUCT(struct sl_bt_evt_system_boot_s {
+    uint16_t major;
+    uint16_t minor;
+    uint16_t patch;
+    uint16_t build;
+    uint32_t bootloader;
+    uint16_t hw;
+    uint32_t hash;
+});
+typedef struct sl_bt_evt_system_boot_s sl_bt_evt_system_boot_t;
+
+PACKSTRUCT(struct sl_bt_evt_system_external_signal_s {
+    uint32_t extsignals;
+});
+typedef struct sl_bt_evt_system_external_signal_s sl_bt_evt_system_external_signal_t;
+
+PACKSTRUCT(struct sl_bt_evt_connection_opened_s {
+    bd_addr address;
+    uint8_t address_type;
+    uint8_t master;
+    uint8_t connection;
+    uint8_t bonding;
+    uint8_t advertiser;
+    uint16_t sync;
+});
+typedef struct sl_bt_evt_connection_opened_s sl_bt_evt_connection_opened_t;
+
+PACKSTRUCT(struct sl_bt_evt_connection_parameters_s {
+    uint8_t connection;
+    uint16_t interval;
+    uint16_t latency;
+    uint16_t timeout;
+    uint8_t security_mode;
+    uint16_t txsize;
+});
+typedef struct sl_bt_evt_connection_parameters_s sl_bt_evt_connection_parameters_t;
+
+PACKSTRUCT(struct sl_bt_evt_connection_phy_status_s {
+    uint8_t connection;
+    uint8_t phy;
+});
+typedef struct sl_bt_evt_connection_phy_status_s sl_bt_evt_connection_phy_status_t;
+
+PACKSTRUCT(struct sl_bt_evt_connection_closed_s {
+    uint16_t reason;
+    uint8_t connection;
+});
+typedef struct sl_bt_evt_connection_closed_s sl_bt_evt_connection_closed_t;
+
+PACKSTRUCT(struct sl_bt_evt_gatt_mtu_exchanged_s {
+    uint8_t connection;
+    uint16_t mtu;
+});
+typedef struct sl_bt_evt_gatt_mtu_exchanged_s sl_bt_evt_gatt_mtu_exchanged_t;
+
+PACKSTRUCT(struct sl_bt_evt_gatt_server_attribute_value_s {
+    uint8_t connection;
+    uint16_t attribute;
+    uint8_t att_opcode;
+    uint16_t offset;
+    uint8array value;
+});
+typedef struct sl_bt_evt_gatt_server_attribute_value_s sl_bt_evt_gatt_server_attribute_value_t;
+
+PACKSTRUCT(struct sl_bt_evt_gatt_server_user_read_request_s {
+    uint8_t connection;
+    uint16_t characteristic;
+    uint8_t att_opcode;
+    uint16_t offset;
+});
+typedef struct sl_bt_evt_gatt_server_user_read_request_s sl_bt_evt_gatt_server_user_read_request_t;
+
+PACKSTRUCT(struct sl_bt_evt_gatt_server_user_write_request_s {
+    uint8_t connection;
+    uint16_t characteristic;
+    uint8_t att_opcode;
+    uint16_t offset;
+    uint8array value;
+});
+typedef struct sl_bt_evt_gatt_server_user_write_request_s sl_bt_evt_gatt_server_user_write_request_t;
+
+PACKSTRUCT(struct sl_bt_evt_gatt_server_characteristic_status_s {
+    uint8_t connection;
+    uint16_t characteristic;
+    uint8_t status_flags;
+    uint16_t client_config_flags;
+    uint32_t client_config;
+});
+typedef struct sl_bt_evt_gatt_server_characteristic_status_s sl_bt_evt_gatt_server_characteristic_status_t;
+
+PACKSTRUCT(struct sl_bt_msg {
+    uint32_t header;
+    union {
+        uint8_t handle;
+        sl_bt_evt_system_boot_t evt_system_boot;
+        sl_bt_evt_system_external_signal_t evt_system_external_signal;
+        sl_bt_evt_connection_opened_t evt_connection_opened;
+        sl_bt_evt_connection_parameters_t evt_connection_parameters;
+        sl_bt_evt_connection_phy_status_t evt_connection_phy_status;
+        sl_bt_evt_connection_closed_t evt_connection_closed;
+        sl_bt_evt_gatt_mtu_exchanged_t evt_gatt_mtu_exchanged;
+        sl_bt_evt_gatt_server_attribute_value_t evt_gatt_server_attribute_value;
+        sl_bt_evt_gatt_server_user_read_request_t evt_gatt_server_user_read_request;
+        sl_bt_evt_gatt_server_user_write_request_t evt_gatt_server_user_write_request;
+        sl_bt_evt_gatt_server_characteristic_status_t evt_gatt_server_characteristic_status;
+        uint8_t payload[256];
+    } data;
+});
+typedef struct sl_bt_msg sl_bt_msg_t;
+
+/**************************************************************************/
+/* Commands                                                               */
+/**************************************************************************/
+sl_status_t sl_bt_external_signal(uint32_t signals);
+uint32_t sl_bt_event_pending_len(void);
+sl_status_t sl_bt_pop_event(sl_bt_msg_t *event);
+void sl_bt_run(void);
+void sl_bt_priority_handle(void);
+
+sl_status_t sl_bt_system_get_identity_address(bd_addr *address, uint8_t *type);
+
+sl_status_t sl_bt_advertiser_create_set(uint8_t *handle);
+sl_status_t sl_bt_advertiser_set_timing(uint8_t advertising_set,
+                                        uint32_t interval_min,
+                                        uint32_t interval_max,
+                                        uint16_t duration,
+                                        uint8_t maxevents);
+sl_status_t sl_bt_advertiser_stop(uint8_t advertising_set);
+sl_status_t sl_bt_legacy_advertiser_generate_data(uint8_t advertising_set, uint8_t discover);
+sl_status_t sl_bt_legacy_advertiser_set_data(uint8_t advertising_set,
+                                             uint8_t type,
+                                             size_t data_len,
+                                             const uint8_t *data);
+sl_status_t sl_bt_legacy_advertiser_start(uint8_t advertising_set, uint8_t connect);
+sl_status_t sl_bt_extended_advertiser_generate_data(uint8_t advertising_set, uint8_t discover);
+sl_status_t sl_bt_periodic_advertiser_set_data(uint8_t advertising_set, size_t data_len, const uint8_t *data);
+sl_status_t sl_bt_periodic_advertiser_start(uint8_t advertising_set,
+                                            uint16_t interval_min,
+                                            uint16_t interval_max,
+                                            uint32_t flags);
+
+sl_status_t sl_bt_connection_set_parameters(uint8_t connection,
+                                            uint16_t min_interval,
+                                            uint16_t max_interval,
+                                            uint16_t latency,
+                                            uint16_t timeout,
+                                            uint16_t min_ce_length,
+                                            uint16_t max_ce_length);
+sl_status_t sl_bt_connection_set_preferred_phy(uint8_t connection, uint8_t preferred_phy, uint8_t accepted_phy);
+
+sl_status_t sl_bt_gatt_server_write_attribute_value(uint16_t attribute,
+                                                    uint16_t offset,
+                                                    size_t value_len,
+                                                    const uint8_t *value);
+sl_status_t sl_bt_gatt_server_read_attribute_value(uint16_t attribute,
+                                                   uint16_t offset,
+                                                   size_t max_value_size,
+                                                   size_t *value_len,
+                                                   uint8_t *value);
+sl_status_t sl_bt_gatt_server_send_notification(uint8_t connection,
+                                                uint16_t characteristic,
+                                                size_t value_len,
+                                                const uint8_t *value);
+sl_status_t sl_bt_gatt_server_send_user_read_response(uint8_t connection,
+                                                      uint16_t characteristic,
+                                                      uint8_t att_errorcode,
+                                                      size_t value_len,
+                                                      const uint8_t *value,
+                                                      uint16_t *sent_len);
+sl_status_t sl_bt_gatt_server_send_user_write_response(uint8_t connection,
+                                                       uint16_t characteristic,
+                                                       uint8_t att_errorcode);
+
+sl_status_t sl_bt_nvm_save(uint16_t key, size_t value_len, const uint8_t *value);
+sl_status_t sl_bt_nvm_load(uint16_t key, size_t max_value_size, size_t *value_len, uint8_t *value);
+
+#endif // SL_BT_API_H
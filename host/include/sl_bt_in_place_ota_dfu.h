@@ -0,0 +1,9 @@
+// Host stand-in for the GSDK sl_bt_in_place_ota_dfu.h.
+#ifndef SL_BT_IN_PLACE_OTA_DFU_H
+#define SL_BT_IN_PLACE_OTA_DFU_H
+
+#include "sl_bt_api.h"
+
+void sl_bt_in_place_ota_dfu_on_event(sl_bt_msg_t *evt);
+
+#endif // SL_BT_IN_PLACE_OTA_DFU_H
@@ -0,0 +1,6 @@
+// Host stand-in for the GSDK sl_bt_stack_config.h. The simulated stack
+// takes no configuration; sl_bluetooth_config.h only needs the header.
+#ifndef SL_BT_STACK_CONFIG_H
+#define SL_BT_STACK_CONFIG_H
+
+#endif // SL_BT_STACK_CONFIG_H
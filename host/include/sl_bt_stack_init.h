@@ -0,0 +1,10 @@
+// Host stand-in for the GSDK sl_bt_stack_init.h. The simulated stack is
+// reset by sl_bt_stack_init() (host/sim/sim_bt.c).
+#ifndef SL_BT_STACK_INIT_H
+#define SL_BT_STACK_INIT_H
+
+#include "sl_status.h"
+
+sl_status_t sl_bt_stack_init(void);
+
+#endif // SL_BT_STACK_INIT_H
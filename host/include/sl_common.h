@@ -0,0 +1,7 @@
+// Host stand-in for the GSDK sl_common.h.
+#ifndef SL_COMMON_H
+#define SL_COMMON_H
+
+#include "em_common.h"
+
+#endif // SL_COMMON_H
@@ -0,0 +1,10 @@
+// Host stand-in for the GSDK sl_debug_swo.h.
+#ifndef SL_DEBUG_SWO_H
+#define SL_DEBUG_SWO_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+sl_status_t sl_debug_swo_enable_itm(uint32_t channel);
+
+#endif // SL_DEBUG_SWO_H
@@ -0,0 +1,9 @@
+// Host stand-in for the GSDK sl_gatt_service_device_information.h.
+#ifndef SL_GATT_SERVICE_DEVICE_INFORMATION_H
+#define SL_GATT_SERVICE_DEVICE_INFORMATION_H
+
+#include "sl_bt_api.h"
+
+void sl_gatt_service_device_information_on_event(sl_bt_msg_t *evt);
+
+#endif // SL_GATT_SERVICE_DEVICE_INFORMATION_H
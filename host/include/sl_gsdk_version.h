@@ -0,0 +1,7 @@
+// Host stand-in for the GSDK sl_gsdk_version.h.
+#ifndef SL_GSDK_VERSION_H
+#define SL_GSDK_VERSION_H
+
+#define SL_GSDK_VERSION_STR     "4.4.4"
+
+#endif // SL_GSDK_VERSION_H
@@ -0,0 +1,16 @@
+// Host stand-in for the GSDK sl_iostream.h.
+#ifndef SL_IOSTREAM_H
+#define SL_IOSTREAM_H
+
+#include <stddef.h>
+#include "sl_status.h"
+
+typedef struct {
+    void *context;
+    sl_status_t (*write)(void *context, const void *buffer, size_t buffer_length);
+    sl_status_t (*read)(void *context, void *buffer, size_t buffer_length, size_t *bytes_read);
+} sl_iostream_t;
+
+sl_status_t sl_iostream_set_default_stream(sl_iostream_t *stream);
+
+#endif // SL_IOSTREAM_H
@@ -0,0 +1,9 @@
+// Host stand-in for the generated sl_iostream_init_usart_instances.h.
+#ifndef SL_IOSTREAM_INIT_USART_INSTANCES_H
+#define SL_IOSTREAM_INIT_USART_INSTANCES_H
+
+#include "sl_power_manager.h"
+
+sl_power_manager_on_isr_exit_t sl_iostream_usart_vcom_sleep_on_isr_exit(void);
+
+#endif // SL_IOSTREAM_INIT_USART_INSTANCES_H
@@ -0,0 +1,17 @@
+// Host stand-in for the GSDK sl_iostream_uart.h. Only the types the
+// generated sl_iostream_init_usart_instances.h names.
+#ifndef SL_IOSTREAM_UART_H
+#define SL_IOSTREAM_UART_H
+
+#include "sl_iostream.h"
+
+typedef struct {
+    sl_iostream_t stream;
+} sl_iostream_uart_t;
+
+typedef struct {
+    sl_iostream_t *handle;
+    char *name;
+} sl_iostream_instance_info_t;
+
+#endif // SL_IOSTREAM_UART_H
@@ -0,0 +1,22 @@
+// Host stand-in for the GSDK sl_led.h.
+#ifndef SL_LED_H
+#define SL_LED_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+typedef uint8_t sl_led_state_t;
+
+#define SL_LED_CURRENT_STATE_OFF    0U
+#define SL_LED_CURRENT_STATE_ON     1U
+
+typedef struct sl_led {
+    void *context;
+} sl_led_t;
+
+void sl_led_turn_on(const sl_led_t *led_handle);
+void sl_led_turn_off(const sl_led_t *led_handle);
+void sl_led_toggle(const sl_led_t *led_handle);
+sl_led_state_t sl_led_get_state(const sl_led_t *led_handle);
+
+#endif // SL_LED_H
@@ -0,0 +1,60 @@
+// Host stand-in for the GSDK sl_power_manager.h. The simulated power
+// manager (host/sim/sim_power.c) sleeps by moving the virtual clock.
+#ifndef SL_POWER_MANAGER_H
+#define SL_POWER_MANAGER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+#include "sl_slist.h"
+
+typedef enum {
+    SL_POWER_MANAGER_EM0 = 0,
+    SL_POWER_MANAGER_EM1,
+    SL_POWER_MANAGER_EM2,
+    SL_POWER_MANAGER_EM3,
+    SL_POWER_MANAGER_EM4
+} sl_power_manager_em_t;
+
+typedef enum {
+    SL_POWER_MANAGER_IGNORE = (1UL << 0),
+    SL_POWER_MANAGER_SLEEP  = (1UL << 1),
+    SL_POWER_MANAGER_WAKEUP = (1UL << 2)
+} sl_power_manager_on_isr_exit_t;
+
+typedef uint32_t sl_power_manager_em_transition_event_t;
+
+#define SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM0  (1 << 0)
+#define SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM0   (1 << 1)
+#define SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM1  (1 << 2)
+#define SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM1   (1 << 3)
+#define SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM2  (1 << 4)
+#define SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM2   (1 << 5)
+#define SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM3  (1 << 6)
+#define SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM3   (1 << 7)
+
+typedef void (*sl_power_manager_em_transition_on_event_t)(sl_power_manager_em_t from,
+                                                          sl_power_manager_em_t to);
+
+typedef struct {
+    sl_power_manager_em_transition_event_t event_mask;
+    sl_power_manager_em_transition_on_event_t on_event;
+} sl_power_manager_em_transition_event_info_t;
+
+typedef struct {
+    sl_slist_node_t node;
+    const sl_power_manager_em_transition_event_info_t *info;
+} sl_power_manager_em_transition_event_handle_t;
+
+void sl_power_manager_add_em_requirement(sl_power_manager_em_t em);
+void sl_power_manager_remove_em_requirement(sl_power_manager_em_t em);
+void sl_power_manager_subscribe_em_transition_event(sl_power_manager_em_transition_event_handle_t *event_handle,
+                                                    const sl_power_manager_em_transition_event_info_t *event_info);
+void sl_power_manager_sleep(void);
+bool sl_power_manager_is_latest_wakeup_internal(void);
+
+// Provided by the generated autogen/sl_power_manager_handler.c.
+bool sl_power_manager_is_ok_to_sleep(void);
+bool sl_power_manager_sleep_on_isr_exit(void);
+
+#endif // SL_POWER_MANAGER_H
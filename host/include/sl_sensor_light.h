@@ -0,0 +1,12 @@
+// Host stand-in for the GSDK sl_sensor_light.h. Readings are set by the
+// test, see sim_sensors.h.
+#ifndef SL_SENSOR_LIGHT_H
+#define SL_SENSOR_LIGHT_H
+
+#include "sl_status.h"
+
+sl_status_t sl_sensor_light_init(void);
+void sl_sensor_light_deinit(void);
+sl_status_t sl_sensor_light_get(float *lux, float *uvi);
+
+#endif // SL_SENSOR_LIGHT_H
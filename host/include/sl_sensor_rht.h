@@ -0,0 +1,13 @@
+// Host stand-in for the GSDK sl_sensor_rht.h. Readings are set by the
+// test, see sim_sensors.h.
+#ifndef SL_SENSOR_RHT_H
+#define SL_SENSOR_RHT_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+sl_status_t sl_sensor_rht_init(void);
+void sl_sensor_rht_deinit(void);
+sl_status_t sl_sensor_rht_get(uint32_t *rh, int32_t *t);
+
+#endif // SL_SENSOR_RHT_H
@@ -0,0 +1,15 @@
+// Host stand-in for the generated sl_simple_led_instances.h.
+#ifndef SL_SIMPLE_LED_INSTANCES_H
+#define SL_SIMPLE_LED_INSTANCES_H
+
+#include "sl_led.h"
+
+#define SL_SIMPLE_LED_COUNT 1
+#define SL_SIMPLE_LED_INSTANCE(n) (sl_simple_led_array[n])
+
+extern const sl_led_t sl_led_led0;
+extern const sl_led_t *sl_simple_led_array[];
+
+void sl_simple_led_init_instances(void);
+
+#endif // SL_SIMPLE_LED_INSTANCES_H
@@ -0,0 +1,77 @@
+// Host stand-in for the GSDK sl_sleeptimer.h, running on the simulator's
+// virtual clock (host/sim/sim_clock.c). Timers fire only when a test or
+// the run loop advances the clock.
+#ifndef SL_SLEEPTIMER_H
+#define SL_SLEEPTIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+
+#define SL_SLEEPTIMER_NO_HIGH_PRECISION_HF_CLOCKS_REQUIRED_FLAG 0x01
+
+typedef struct sl_sleeptimer_timer_handle sl_sleeptimer_timer_handle_t;
+
+typedef void (*sl_sleeptimer_timer_callback_t)(sl_sleeptimer_timer_handle_t *handle, void *data);
+
+// Fields are private to the simulator.
+struct sl_sleeptimer_timer_handle {
+    void *callback_data;
+    uint8_t priority;
+    uint16_t option_flags;
+    sl_sleeptimer_timer_handle_t *next;
+    sl_sleeptimer_timer_callback_t callback;
+    uint32_t timeout_periodic;
+    uint64_t expiry;                // absolute virtual tick
+};
+
+sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
+                                      uint32_t timeout,
+                                      sl_sleeptimer_timer_callback_t callback,
+                                      void *callback_data,
+                                      uint8_t priority,
+                                      uint16_t option_flags);
+sl_status_t sl_sleeptimer_restart_timer(sl_sleeptimer_timer_handle_t *handle,
+                                        uint32_t timeout,
+                                        sl_sleeptimer_timer_callback_t callback,
+                                        void *callback_data,
+                                        uint8_t priority,
+                                        uint16_t option_flags);
+sl_status_t sl_sleeptimer_start_periodic_timer(sl_sleeptimer_timer_handle_t *handle,
+                                               uint32_t timeout,
+                                               sl_sleeptimer_timer_callback_t callback,
+                                               void *callback_data,
+                                               uint8_t priority,
+                                               uint16_t option_flags);
+sl_status_t sl_sleeptimer_start_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                         uint32_t timeout_ms,
+                                         sl_sleeptimer_timer_callback_t callback,
+                                         void *callback_data,
+                                         uint8_t priority,
+                                         uint16_t option_flags);
+sl_status_t sl_sleeptimer_restart_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                           uint32_t timeout_ms,
+                                           sl_sleeptimer_timer_callback_t callback,
+                                           void *callback_data,
+                                           uint8_t priority,
+                                           uint16_t option_flags);
+sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                  uint32_t timeout_ms,
+                                                  sl_sleeptimer_timer_callback_t callback,
+                                                  void *callback_data,
+                                                  uint8_t priority,
+                                                  uint16_t option_flags);
+sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle);
+sl_status_t sl_sleeptimer_is_timer_running(sl_sleeptimer_timer_handle_t *handle, bool *running);
+sl_status_t sl_sleeptimer_get_remaining_time(sl_sleeptimer_timer_handle_t *handle, uint32_t *time);
+
+uint32_t sl_sleeptimer_get_tick_count(void);
+uint64_t sl_sleeptimer_get_tick_count64(void);
+uint32_t sl_sleeptimer_get_timer_frequency(void);
+
+uint32_t sl_sleeptimer_ms_to_tick(uint16_t time_ms);
+sl_status_t sl_sleeptimer_ms32_to_tick(uint32_t time_ms, uint32_t *tick);
+uint32_t sl_sleeptimer_tick_to_ms(uint32_t tick);
+sl_status_t sl_sleeptimer_tick64_to_ms(uint64_t tick, uint64_t *ms);
+
+#endif // SL_SLEEPTIMER_H
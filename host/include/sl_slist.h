@@ -0,0 +1,11 @@
+// Host stand-in for the GSDK sl_slist.h.
+#ifndef SL_SLIST_H
+#define SL_SLIST_H
+
+typedef struct sl_slist_node sl_slist_node_t;
+
+struct sl_slist_node {
+    sl_slist_node_t *node;
+};
+
+#endif // SL_SLIST_H
@@ -0,0 +1,33 @@
+// Host stand-in for the GSDK sl_status.h. Only the codes the application
+// uses; each is distinct, but not all values match the SDK.
+#ifndef SL_STATUS_H
+#define SL_STATUS_H
+
+#include <stdint.h>
+
+typedef uint32_t sl_status_t;
+
+#define SL_STATUS_OK                     ((sl_status_t)0x0000)
+#define SL_STATUS_FAIL                   ((sl_status_t)0x0001)
+#define SL_STATUS_INVALID_STATE          ((sl_status_t)0x0002)
+#define SL_STATUS_NOT_READY              ((sl_status_t)0x0003)
+#define SL_STATUS_BUSY                   ((sl_status_t)0x0004)
+#define SL_STATUS_IN_PROGRESS            ((sl_status_t)0x0005)
+#define SL_STATUS_TIMEOUT                ((sl_status_t)0x0007)
+#define SL_STATUS_NOT_FOUND              ((sl_status_t)0x000C)
+#define SL_STATUS_ALREADY_EXISTS         ((sl_status_t)0x000E)
+#define SL_STATUS_NOT_SUPPORTED          ((sl_status_t)0x000F)
+#define SL_STATUS_INITIALIZATION         ((sl_status_t)0x0010)
+#define SL_STATUS_NOT_INITIALIZED        ((sl_status_t)0x0011)
+#define SL_STATUS_ALLOCATION_FAILED      ((sl_status_t)0x0018)
+#define SL_STATUS_NO_MORE_RESOURCE       ((sl_status_t)0x0019)
+#define SL_STATUS_EMPTY                  ((sl_status_t)0x001A)
+#define SL_STATUS_FULL                   ((sl_status_t)0x001B)
+#define SL_STATUS_WOULD_OVERFLOW         ((sl_status_t)0x001C)
+#define SL_STATUS_INVALID_PARAMETER      ((sl_status_t)0x0021)
+#define SL_STATUS_INVALID_CONFIGURATION  ((sl_status_t)0x0022)
+#define SL_STATUS_INVALID_RANGE          ((sl_status_t)0x0028)
+#define SL_STATUS_TRANSMIT               ((sl_status_t)0x0031)
+#define SL_STATUS_IO                     ((sl_status_t)0x0034)
+
+#endif // SL_STATUS_H
@@ -0,0 +1,8 @@
+// Host stand-in for the GSDK sli_bt_gattdb_def.h. The host build uses
+// the attribute handles of autogen/gatt_db.h, not the database itself.
+#ifndef SLI_BT_GATTDB_DEF_H
+#define SLI_BT_GATTDB_DEF_H
+
+typedef struct sli_bt_gattdb_s sli_bt_gattdb_t;
+
+#endif // SLI_BT_GATTDB_DEF_H
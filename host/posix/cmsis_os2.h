@@ -0,0 +1,89 @@
+// Host stand-in for the CMSIS-RTOS2 cmsis_os2.h: the subset the
+// application uses, implemented over pthreads by cmsis_os2_posix.c.
+#ifndef CMSIS_OS2_H
+#define CMSIS_OS2_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define osWaitForever           0xFFFFFFFFU
+
+#define osFlagsWaitAny          0x00000000U
+#define osFlagsWaitAll          0x00000001U
+#define osFlagsNoClear          0x00000002U
+
+#define osFlagsError            0x80000000U
+#define osFlagsErrorUnknown     0xFFFFFFFFU
+#define osFlagsErrorTimeout     0xFFFFFFFEU
+#define osFlagsErrorResource    0xFFFFFFFDU
+#define osFlagsErrorParameter   0xFFFFFFFCU
+#define osFlagsErrorISR         0xFFFFFFFAU
+
+typedef enum {
+    osOK                    =  0,
+    osError                 = -1,
+    osErrorTimeout          = -2,
+    osErrorResource         = -3,
+    osErrorParameter        = -4,
+    osErrorNoMemory         = -5,
+    osErrorISR              = -6,
+} osStatus_t;
+
+typedef enum {
+    osKernelInactive        =  0,
+    osKernelReady           =  1,
+    osKernelRunning         =  2,
+} osKernelState_t;
+
+typedef enum {
+    osPriorityNone          =  0,
+    osPriorityIdle          =  1,
+    osPriorityLow           =  8,
+    osPriorityNormal        = 24,
+    osPriorityHigh          = 40,
+    osPriorityRealtime      = 48,
+    osPriorityISR           = 56,
+} osPriority_t;
+
+typedef void (*osThreadFunc_t)(void *argument);
+typedef void *osThreadId_t;
+typedef void *osMessageQueueId_t;
+
+typedef struct {
+    const char *name;
+    uint32_t attr_bits;
+    void *cb_mem;
+    uint32_t cb_size;
+    void *stack_mem;
+    uint32_t stack_size;
+    osPriority_t priority;
+    uint32_t tz_module;
+    uint32_t reserved;
+} osThreadAttr_t;
+
+typedef struct {
+    const char *name;
+    uint32_t attr_bits;
+    void *cb_mem;
+    uint32_t cb_size;
+    void *mq_mem;
+    uint32_t mq_size;
+} osMessageQueueAttr_t;
+
+osStatus_t osKernelInitialize(void);
+osStatus_t osKernelStart(void);
+osKernelState_t osKernelGetState(void);
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osThreadId_t osThreadGetId(void);
+const char *osThreadGetName(osThreadId_t thread_id);
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags);
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr);
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout);
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
+uint32_t osMessageQueueGetCount(osMessageQueueId_t mq_id);
+
+#endif // CMSIS_OS2_H
@@ -0,0 +1,441 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cmsis_os2.h"
+#include "cmsis_os2_posix.h"
+
+#define REALTIME_CPU    0
+
+static pthread_mutex_t kernel_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t idle_cond = PTHREAD_COND_INITIALIZER;
+static osKernelState_t kernel_state = osKernelInactive;
+static sim_os_thread_t *threads = NULL;
+static uint32_t ready_count = 0;
+static bool realtime = false;
+
+// The calling thread's control block, NULL outside kernel threads.
+static __thread sim_os_thread_t *self = NULL;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**************************************************************************/
+/* Scheduling                                                             */
+/* All called with kernel_lock held.                                      */
+/**************************************************************************/
+static void make_ready(sim_os_thread_t *thread) {
+    if (thread->state != SIM_OS_THREAD_BLOCKED) {
+        return;
+    }
+    thread->state = SIM_OS_THREAD_READY;
+    thread->waiting_on = NULL;
+    thread->readied_ns = now_ns();
+    ready_count++;
+    pthread_cond_signal(&thread->cond);
+}
+
+static void not_ready(void) {
+    ready_count--;
+    if (ready_count == 0) {
+        pthread_cond_broadcast(&idle_cond);
+    }
+}
+
+// Block the calling thread until another readies it.
+static void block(sim_os_thread_t *thread) {
+    uint64_t latency;
+
+    thread->state = SIM_OS_THREAD_BLOCKED;
+    not_ready();
+    while (thread->state == SIM_OS_THREAD_BLOCKED) {
+        pthread_cond_wait(&thread->cond, &kernel_lock);
+    }
+    latency = now_ns() - thread->readied_ns;
+    thread->latency.wakeups++;
+    thread->latency.total_ns += latency;
+    if (latency > thread->latency.max_ns) {
+        thread->latency.max_ns = latency;
+    }
+}
+
+static bool flags_satisfied(const sim_os_thread_t *thread, uint32_t flags, uint32_t options) {
+    if (options & osFlagsWaitAll) {
+        return (thread->flags & flags) == flags;
+    }
+    return (thread->flags & flags) != 0;
+}
+
+// Ready the highest priority thread blocked on the queue in that direction.
+static void ready_queue_waiter(sim_os_queue_t *queue, bool to_put) {
+    sim_os_thread_t *best = NULL;
+
+    for (sim_os_thread_t *thread = threads; thread != NULL; thread = thread->next) {
+        if (thread->state == SIM_OS_THREAD_BLOCKED && thread->waiting_on == queue
+            && thread->waiting_to_put == to_put
+            && (best == NULL || thread->priority > best->priority)) {
+            best = thread;
+        }
+    }
+    if (best != NULL) {
+        make_ready(best);
+    }
+}
+
+static void *thread_main(void *argument) {
+    sim_os_thread_t *thread = argument;
+
+    self = thread;
+    pthread_mutex_lock(&kernel_lock);
+    while (thread->state != SIM_OS_THREAD_READY) {
+        pthread_cond_wait(&thread->cond, &kernel_lock);
+    }
+    pthread_mutex_unlock(&kernel_lock);
+
+    thread->func(thread->argument);
+
+    pthread_mutex_lock(&kernel_lock);
+    thread->state = SIM_OS_THREAD_TERMINATED;
+    not_ready();
+    pthread_mutex_unlock(&kernel_lock);
+    return NULL;
+}
+
+static int start_pthread(sim_os_thread_t *thread) {
+    pthread_attr_t attr;
+    int err;
+
+    if (realtime) {
+        struct sched_param param = { .sched_priority = (int)thread->priority };
+        cpu_set_t cpus;
+
+        CPU_ZERO(&cpus);
+        CPU_SET(REALTIME_CPU, &cpus);
+        pthread_attr_init(&attr);
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        pthread_attr_setschedparam(&attr, &param);
+        pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+        err = pthread_create(&thread->pthread, &attr, thread_main, thread);
+        pthread_attr_destroy(&attr);
+        if (err != EPERM) {
+            return err;
+        }
+        fprintf(stderr, "cmsis_os2_posix: no permission for SCHED_FIFO, using the default policy\n");
+        realtime = false;
+    }
+    return pthread_create(&thread->pthread, NULL, thread_main, thread);
+}
+
+/**************************************************************************/
+/* Kernel                                                                 */
+/**************************************************************************/
+osStatus_t osKernelInitialize(void) {
+    const char *mode = getenv("SIM_OS_REALTIME");
+
+    if (kernel_state != osKernelInactive) {
+        return osError;
+    }
+    realtime = (mode != NULL && strcmp(mode, "1") == 0);
+    kernel_state = osKernelReady;
+    return osOK;
+}
+
+osStatus_t osKernelStart(void) {
+    pthread_mutex_lock(&kernel_lock);
+    if (kernel_state != osKernelReady) {
+        pthread_mutex_unlock(&kernel_lock);
+        return osError;
+    }
+    kernel_state = osKernelRunning;
+    for (sim_os_thread_t *thread = threads; thread != NULL; thread = thread->next) {
+        if (thread->state == SIM_OS_THREAD_CREATED) {
+            thread->state = SIM_OS_THREAD_READY;
+            ready_count++;
+            pthread_cond_signal(&thread->cond);
+        }
+    }
+    pthread_mutex_unlock(&kernel_lock);
+    return osOK;
+}
+
+osKernelState_t osKernelGetState(void) {
+    return kernel_state;
+}
+
+/**************************************************************************/
+/* Threads                                                                */
+/**************************************************************************/
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+    sim_os_thread_t *thread;
+    bool allocated = false;
+
+    if (func == NULL || kernel_state == osKernelInactive) {
+        return NULL;
+    }
+    if (attr != NULL && attr->cb_mem != NULL && attr->cb_size >= sizeof(sim_os_thread_t)) {
+        thread = attr->cb_mem;
+    } else if (attr != NULL && attr->cb_mem != NULL) {
+        return NULL;
+    } else {
+        thread = malloc(sizeof(sim_os_thread_t));
+        allocated = true;
+        if (thread == NULL) {
+            return NULL;
+        }
+    }
+    memset(thread, 0, sizeof(*thread));
+    thread->name = (attr != NULL) ? attr->name : NULL;
+    thread->func = func;
+    thread->argument = argument;
+    thread->priority = (attr != NULL && attr->priority != osPriorityNone) ? attr->priority : osPriorityNormal;
+    thread->state = SIM_OS_THREAD_CREATED;
+    thread->allocated = allocated;
+    pthread_cond_init(&thread->cond, NULL);
+
+    // The thread waits in thread_main() until it is made ready below.
+    if (start_pthread(thread) != 0) {
+        pthread_cond_destroy(&thread->cond);
+        if (allocated) {
+            free(thread);
+        }
+        return NULL;
+    }
+    pthread_mutex_lock(&kernel_lock);
+    sim_os_thread_t **link = &threads;
+    while (*link != NULL) {
+        link = &(*link)->next;
+    }
+    *link = thread;
+    if (kernel_state == osKernelRunning) {
+        thread->state = SIM_OS_THREAD_READY;
+        ready_count++;
+        pthread_cond_signal(&thread->cond);
+    }
+    pthread_mutex_unlock(&kernel_lock);
+    return thread;
+}
+
+osThreadId_t osThreadGetId(void) {
+    return self;
+}
+
+const char *osThreadGetName(osThreadId_t thread_id) {
+    return (thread_id != NULL) ? ((sim_os_thread_t *)thread_id)->name : NULL;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags) {
+    sim_os_thread_t *thread = thread_id;
+    uint32_t result;
+
+    if (thread == NULL || (flags & osFlagsError)) {
+        return osFlagsErrorParameter;
+    }
+    pthread_mutex_lock(&kernel_lock);
+    thread->flags |= flags;
+    result = thread->flags;
+    if (thread->state == SIM_OS_THREAD_BLOCKED && thread->wait_flags != 0
+        && flags_satisfied(thread, thread->wait_flags, thread->wait_options)) {
+        make_ready(thread);
+    }
+    pthread_mutex_unlock(&kernel_lock);
+    return result;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout) {
+    sim_os_thread_t *thread = self;
+    uint32_t result;
+
+    if (thread == NULL) {
+        return osFlagsErrorISR;
+    }
+    if (flags == 0 || (flags & osFlagsError)) {
+        return osFlagsErrorParameter;
+    }
+    pthread_mutex_lock(&kernel_lock);
+    while (!flags_satisfied(thread, flags, options)) {
+        if (timeout != osWaitForever) {
+            pthread_mutex_unlock(&kernel_lock);
+            return (timeout == 0) ? osFlagsErrorResource : osFlagsErrorParameter;
+        }
+        thread->wait_flags = flags;
+        thread->wait_options = options;
+        block(thread);
+        thread->wait_flags = 0;
+    }
+    result = thread->flags;
+    if (!(options & osFlagsNoClear)) {
+        thread->flags &= ~flags;
+    }
+    pthread_mutex_unlock(&kernel_lock);
+    return result;
+}
+
+/**************************************************************************/
+/* Message Queues                                                         */
+/**************************************************************************/
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
+    sim_os_queue_t *queue;
+    uint8_t *mem;
+
+    if (msg_count == 0 || msg_size == 0) {
+        return NULL;
+    }
+    if (attr != NULL && attr->cb_mem != NULL) {
+        if (attr->cb_size < sizeof(sim_os_queue_t)
+            || attr->mq_mem == NULL || attr->mq_size < msg_count * msg_size) {
+            return NULL;
+        }
+        queue = attr->cb_mem;
+        mem = attr->mq_mem;
+    } else {
+        queue = malloc(sizeof(sim_os_queue_t));
+        mem = malloc(msg_count * msg_size);
+        if (queue == NULL || mem == NULL) {
+            free(queue);
+            free(mem);
+            return NULL;
+        }
+    }
+    memset(queue, 0, sizeof(*queue));
+    queue->name = (attr != NULL) ? attr->name : NULL;
+    queue->mem = mem;
+    queue->msg_count = msg_count;
+    queue->msg_size = msg_size;
+    return queue;
+}
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+    sim_os_queue_t *queue = mq_id;
+    (void)msg_prio;
+
+    if (queue == NULL || msg_ptr == NULL) {
+        return osErrorParameter;
+    }
+    pthread_mutex_lock(&kernel_lock);
+    while (queue->used == queue->msg_count) {
+        if (timeout == 0 || timeout != osWaitForever || self == NULL) {
+            pthread_mutex_unlock(&kernel_lock);
+            return (timeout == 0) ? osErrorResource : osErrorParameter;
+        }
+        self->waiting_on = queue;
+        self->waiting_to_put = true;
+        block(self);
+    }
+    memcpy(queue->mem + ((queue->head + queue->used) % queue->msg_count) * queue->msg_size,
+           msg_ptr, queue->msg_size);
+    queue->used++;
+    ready_queue_waiter(queue, false);
+    pthread_mutex_unlock(&kernel_lock);
+    return osOK;
+}
+
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+    sim_os_queue_t *queue = mq_id;
+
+    if (queue == NULL || msg_ptr == NULL) {
+        return osErrorParameter;
+    }
+    pthread_mutex_lock(&kernel_lock);
+    while (queue->used == 0) {
+        if (timeout == 0 || timeout != osWaitForever || self == NULL) {
+            pthread_mutex_unlock(&kernel_lock);
+            return (timeout == 0) ? osErrorResource : osErrorParameter;
+        }
+        self->waiting_on = queue;
+        self->waiting_to_put = false;
+        block(self);
+    }
+    memcpy(msg_ptr, queue->mem + queue->head * queue->msg_size, queue->msg_size);
+    queue->head = (queue->head + 1) % queue->msg_count;
+    queue->used--;
+    if (msg_prio != NULL) {
+        *msg_prio = 0;
+    }
+    ready_queue_waiter(queue, true);
+    pthread_mutex_unlock(&kernel_lock);
+    return osOK;
+}
+
+uint32_t osMessageQueueGetCount(osMessageQueueId_t mq_id) {
+    sim_os_queue_t *queue = mq_id;
+    uint32_t count;
+
+    if (queue == NULL) {
+        return 0;
+    }
+    pthread_mutex_lock(&kernel_lock);
+    count = queue->used;
+    pthread_mutex_unlock(&kernel_lock);
+    return count;
+}
+
+/**************************************************************************/
+/* Simulator Interface                                                    */
+/**************************************************************************/
+void sim_os_wait_idle(void) {
+    pthread_mutex_lock(&kernel_lock);
+    while (ready_count > 0) {
+        pthread_cond_wait(&idle_cond, &kernel_lock);
+    }
+    pthread_mutex_unlock(&kernel_lock);
+}
+
+bool sim_os_thread_ready(void) {
+    bool ready;
+
+    pthread_mutex_lock(&kernel_lock);
+    ready = (ready_count > 0);
+    pthread_mutex_unlock(&kernel_lock);
+    return ready;
+}
+
+bool sim_os_realtime(void) {
+    return realtime;
+}
+
+bool sim_os_latency(const char *name, sim_os_latency_t *latency) {
+    bool found = false;
+
+    pthread_mutex_lock(&kernel_lock);
+    for (sim_os_thread_t *thread = threads; thread != NULL; thread = thread->next) {
+        if (thread->name != NULL && strcmp(thread->name, name) == 0) {
+            *latency = thread->latency;
+            found = true;
+        }
+    }
+    pthread_mutex_unlock(&kernel_lock);
+    return found;
+}
+
+void sim_os_latency_reset(void) {
+    pthread_mutex_lock(&kernel_lock);
+    for (sim_os_thread_t *thread = threads; thread != NULL; thread = thread->next) {
+        memset(&thread->latency, 0, sizeof(thread->latency));
+    }
+    pthread_mutex_unlock(&kernel_lock);
+}
+
+void sim_os_latency_print(void) {
+    pthread_mutex_lock(&kernel_lock);
+    printf("Wake-up latency (%s):\n", realtime ? "SCHED_FIFO, one CPU" : "default policy");
+    printf("  %-12s %8s %8s %10s %10s\n", "thread", "priority", "wakeups", "mean us", "max us");
+    for (sim_os_thread_t *thread = threads; thread != NULL; thread = thread->next) {
+        const sim_os_latency_t *latency = &thread->latency;
+        printf("  %-12s %8d %8u %10.1f %10.1f\n",
+               thread->name != NULL ? thread->name : "?",
+               (int)thread->priority,
+               latency->wakeups,
+               latency->wakeups ? latency->total_ns / 1000.0 / latency->wakeups : 0.0,
+               latency->max_ns / 1000.0);
+    }
+    pthread_mutex_unlock(&kernel_lock);
+}
@@ -0,0 +1,87 @@
+#ifndef CMSIS_OS2_POSIX_H
+#define CMSIS_OS2_POSIX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "cmsis_os2.h"
+
+/**************************************************************************/
+/* CMSIS-RTOS2 over pthreads.                                             */
+/*                                                                        */
+/* Each thread is a pthread. Thread flags and message queues block on a   */
+/* condition variable under one kernel lock. The kernel counts the        */
+/* threads that are ready or running: the simulator's idle loop           */
+/* (sim_kernel.c) waits for that count to reach zero before it moves the  */
+/* virtual clock, so timers fire at the same ticks as in the bare-metal   */
+/* build, however the host schedules the threads.                         */
+/*                                                                        */
+/* With SIM_OS_REALTIME=1 in the environment the threads run SCHED_FIFO   */
+/* at their CMSIS priority, pinned to one CPU, like the tasks of the      */
+/* single-core target; this needs CAP_SYS_NICE. Otherwise they run under  */
+/* the default policy on any CPU.                                         */
+/*                                                                        */
+/* Stack memory passed in osThreadAttr_t is not used: host stacks are     */
+/* larger. Only zero and osWaitForever timeouts are supported.            */
+/**************************************************************************/
+
+typedef enum {
+    SIM_OS_THREAD_CREATED,      // waiting for osKernelStart()
+    SIM_OS_THREAD_READY,        // ready or running
+    SIM_OS_THREAD_BLOCKED,
+    SIM_OS_THREAD_TERMINATED
+} sim_os_thread_state_t;
+
+// Wake-up latency: from the flag set or message put that readied a
+// blocked thread to that thread running again.
+typedef struct {
+    uint32_t wakeups;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} sim_os_latency_t;
+
+typedef struct sim_os_thread {
+    const char *name;
+    osThreadFunc_t func;
+    void *argument;
+    osPriority_t priority;
+    pthread_t pthread;
+    pthread_cond_t cond;
+    sim_os_thread_state_t state;
+    uint32_t flags;
+    uint32_t wait_flags;            // flags a blocked osThreadFlagsWait() needs
+    uint32_t wait_options;
+    struct sim_os_queue *waiting_on;
+    bool waiting_to_put;
+    uint64_t readied_ns;
+    sim_os_latency_t latency;
+    bool allocated;
+    struct sim_os_thread *next;
+} sim_os_thread_t;
+
+typedef struct sim_os_queue {
+    const char *name;
+    uint8_t *mem;
+    uint32_t msg_count;
+    uint32_t msg_size;
+    uint32_t head;
+    uint32_t used;
+} sim_os_queue_t;
+
+// Block until every thread is blocked or terminated.
+void sim_os_wait_idle(void);
+
+// True if a thread is ready or running.
+bool sim_os_thread_ready(void);
+
+// True if the threads run SCHED_FIFO on one CPU.
+bool sim_os_realtime(void);
+
+// Wake-up latency of a thread, by name. False if there is none.
+bool sim_os_latency(const char *name, sim_os_latency_t *latency);
+void sim_os_latency_reset(void);
+
+// Print every thread's wake-up latency.
+void sim_os_latency_print(void);
+
+#endif // CMSIS_OS2_POSIX_H
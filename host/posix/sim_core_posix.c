@@ -0,0 +1,50 @@
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include "em_core.h"
+#include "em_device.h"
+#include "sim_platform.h"
+
+// Kernel threads share the simulated core: masking interrupts takes one
+// process-wide recursive lock, which the simulated interrupts take too, so
+// a critical section excludes both the other threads and the sleeptimer
+// interrupt, as on the single-core target.
+static pthread_mutex_t core_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static __thread uint32_t nesting = 0;
+static __thread uint32_t irq_depth = 0;
+
+CORE_irqState_t sim_core_enter(void) {
+    pthread_mutex_lock(&core_lock);
+    return nesting++;
+}
+
+void sim_core_exit(CORE_irqState_t state) {
+    nesting = state;
+    pthread_mutex_unlock(&core_lock);
+}
+
+bool CORE_IrqIsDisabled(void) {
+    return nesting > 0;
+}
+
+bool CORE_InIrqContext(void) {
+    return irq_depth > 0;
+}
+
+void sim_irq_set_pending(int irqn) {
+    pthread_mutex_lock(&core_lock);
+    NVIC->ISPR[irqn / 32] |= 1UL << (irqn % 32);
+    pthread_mutex_unlock(&core_lock);
+}
+
+void sim_irq_enter(int irqn) {
+    pthread_mutex_lock(&core_lock);
+    NVIC->ISPR[irqn / 32] &= ~(1UL << (irqn % 32));
+    irq_depth++;
+}
+
+void sim_irq_exit(int irqn) {
+    (void)irqn;
+    irq_depth--;
+    pthread_mutex_unlock(&core_lock);
+}
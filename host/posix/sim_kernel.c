@@ -0,0 +1,111 @@
+#include "sl_component_catalog.h"
+#include "em_core.h"
+#include "app.h"
+#include "sl_bluetooth.h"
+#include "sl_power_manager.h"
+#include "cmsis_os2.h"
+#include "sl_cmsis_os2_common.h"
+#include "sim.h"
+#include "sim_kernel.h"
+
+#define EVENT_WAITING_FLAG  0x1UL
+
+extern sl_status_t sli_bt_system_start_bluetooth(void);
+
+static osThreadId_t event_thread;
+static uint32_t events = 0;
+static bool wake_deferred = false;
+
+static __ALIGNED(4) uint8_t event_thread_cb[osThreadCbSize];
+
+/**************************************************************************/
+/* Bluetooth Event Task                                                   */
+/**************************************************************************/
+static void event_task(void *argument) {
+    sl_bt_msg_t evt;
+    (void)argument;
+
+    sli_bt_system_start_bluetooth();
+    for (;;) {
+        osThreadFlagsWait(EVENT_WAITING_FLAG, osFlagsWaitAny, osWaitForever);
+        while (sl_bt_pop_event(&evt) == SL_STATUS_OK) {
+            sl_bt_process_event(&evt);
+            CORE_ATOMIC_SECTION(events++;)
+        }
+    }
+}
+
+static void event_queued(void) {
+    // Events the test queues wait for its next sim_run_*() call, as they
+    // wait for the super loop in the bare-metal build. Tasks and
+    // interrupts wake the event task at once.
+    if (osThreadGetId() == NULL && !CORE_InIrqContext()) {
+        wake_deferred = true;
+        return;
+    }
+    osThreadFlagsSet(event_thread, EVENT_WAITING_FLAG);
+}
+
+uint32_t sim_kernel_events(void) {
+    uint32_t count;
+
+    CORE_ATOMIC_SECTION(count = events;)
+    return count;
+}
+
+/**************************************************************************/
+/* main() and the Idle Task                                               */
+/**************************************************************************/
+void sim_boot(void) {
+    const osThreadAttr_t event_attr = {
+        .name = SIM_KERNEL_EVENT_TASK_NAME,
+        .cb_mem = event_thread_cb,
+        .cb_size = osThreadCbSize,
+        .priority = (osPriority_t)SL_BT_RTOS_EVENT_HANDLER_TASK_PRIORITY,
+    };
+
+    // sl_system_init(), with the RTOS adaptation creating its task.
+    sim_init();
+    osKernelInitialize();
+    event_thread = osThreadNew(event_task, NULL, &event_attr);
+    sim_bt_set_event_callback(event_queued);
+
+    app_init();
+    osKernelStart();
+    sim_bt_boot();
+    sim_run_idle();
+}
+
+void sim_run_until(uint64_t tick) {
+    sim_power_set_horizon(tick);
+    if (wake_deferred) {
+        wake_deferred = false;
+        osThreadFlagsSet(event_thread, EVENT_WAITING_FLAG);
+    }
+    for (;;) {
+        // The idle task only runs once every other task is blocked.
+        sim_os_wait_idle();
+
+        uint64_t next;
+        bool due = sim_clock_next_expiry(&next) && next <= sim_clock_ticks();
+        if (!due && sim_clock_ticks() >= tick) {
+            break;
+        }
+
+        uint32_t sleeps = sim_power_sleeps();
+        sl_power_manager_sleep();
+        if (sim_power_sleeps() == sleeps && !sim_os_thread_ready()) {
+            // Sleep refused with no task ready: idle spins in EM0 until
+            // the next interrupt.
+            sim_clock_step(tick);
+        }
+    }
+}
+
+void sim_run_ms(uint32_t ms) {
+    sim_run_until(sim_clock_ticks() + sim_clock_ms_to_ticks(ms));
+}
+
+void sim_run_idle(void) {
+    sim_run_until(sim_clock_ticks());
+}
@@ -0,0 +1,28 @@
+#ifndef SIM_KERNEL_H
+#define SIM_KERNEL_H
+
+#include <stdint.h>
+#include "cmsis_os2_posix.h"
+
+/**************************************************************************/
+/* Kernel build of the simulator.                                         */
+/*                                                                        */
+/* Stands in for main() with SL_CATALOG_KERNEL_PRESENT and for the        */
+/* Bluetooth RTOS adaptation: sim_boot() creates the Bluetooth event      */
+/* task, runs app_init() (which creates the application tasks) and starts */
+/* the kernel. The event task pops each queued stack event and passes it  */
+/* to sl_bt_process_event(). The sim.h run loop is the idle task: once    */
+/* every task is blocked it calls sl_power_manager_sleep(), which moves   */
+/* the virtual clock to the next timer and runs its interrupt.            */
+/**************************************************************************/
+
+#ifndef SL_BT_RTOS_EVENT_HANDLER_TASK_PRIORITY
+#define SL_BT_RTOS_EVENT_HANDLER_TASK_PRIORITY  50
+#endif
+
+#define SIM_KERNEL_EVENT_TASK_NAME  "bt_event"
+
+// Stack events the event task has passed to sl_bt_process_event().
+uint32_t sim_kernel_events(void);
+
+#endif // SIM_KERNEL_H
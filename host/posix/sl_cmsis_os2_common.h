@@ -0,0 +1,16 @@
+// Host stand-in for the GSDK sl_cmsis_os2_common.h. Control block sizes
+// for statically allocated kernel objects, and the CMSIS alignment macro.
+#ifndef SL_CMSIS_OS2_COMMON_H
+#define SL_CMSIS_OS2_COMMON_H
+
+#include "cmsis_os2.h"
+#include "cmsis_os2_posix.h"
+
+#ifndef __ALIGNED
+#define __ALIGNED(x)            __attribute__((aligned(x)))
+#endif
+
+#define osThreadCbSize          sizeof(sim_os_thread_t)
+#define osMessageQueueCbSize    sizeof(sim_os_queue_t)
+
+#endif // SL_CMSIS_OS2_COMMON_H
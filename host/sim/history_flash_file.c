@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "history_flash.h"
+#include "history_flash_file.h"
+#include "sim_clock.h"
+
+static FILE *image_file = NULL;
+static uint8_t *image = NULL;
+static uint32_t image_size = 0;
+static uint32_t flash_size = 0;          // 0 until history_flash_init()
+
+static bool powered_down = true;
+static bool erasing = false;
+static uint64_t erase_done_tick;
+
+static uint32_t erases;
+static uint32_t programs;
+static uint32_t stalls;
+
+static void write_through(uint32_t address, uint32_t len) {
+    fseek(image_file, (long)address, SEEK_SET);
+    fwrite(&image[address], 1, len, image_file);
+    fflush(image_file);
+}
+
+static void wake(void) {
+    powered_down = false;
+}
+
+// The driver waits for the erase to end before touching the part.
+static void wait_ready(void) {
+    if (erasing) {
+        if (sim_clock_ticks() < erase_done_tick) {
+            stalls++;
+        }
+        erasing = false;
+    }
+}
+
+static void sleep_if_idle(void) {
+    if (!erasing) {
+        powered_down = true;
+    }
+}
+
+/**************************************************************************/
+/* Image                                                                  */
+/**************************************************************************/
+sl_status_t sim_flash_open(const char *path, uint32_t size) {
+    sim_flash_close();
+    image = malloc(size);
+    if (image == NULL) {
+        return SL_STATUS_ALLOCATION_FAILED;
+    }
+    memset(image, 0xFF, size);
+
+    image_file = fopen(path, "r+b");
+    if (image_file != NULL) {
+        size_t len = fread(image, 1, size, image_file);
+        (void)len;                      // a short image reads as erased
+    } else {
+        image_file = fopen(path, "w+b");
+        if (image_file == NULL) {
+            free(image);
+            image = NULL;
+            return SL_STATUS_FAIL;
+        }
+    }
+    image_size = size;
+    write_through(0, size);
+    powered_down = true;
+    erasing = false;
+    erases = 0;
+    programs = 0;
+    stalls = 0;
+    return SL_STATUS_OK;
+}
+
+void sim_flash_close(void) {
+    if (image_file != NULL) {
+        fclose(image_file);
+        image_file = NULL;
+    }
+    free(image);
+    image = NULL;
+    image_size = 0;
+    flash_size = 0;
+}
+
+uint32_t sim_flash_erases(void) {
+    return erases;
+}
+
+uint32_t sim_flash_programs(void) {
+    return programs;
+}
+
+uint32_t sim_flash_stalls(void) {
+    return stalls;
+}
+
+bool sim_flash_is_powered_down(void) {
+    return powered_down;
+}
+
+/**************************************************************************/
+/* history_flash                                                          */
+/**************************************************************************/
+sl_status_t history_flash_init(void) {
+    if (image == NULL) {
+        flash_size = 0;
+        return SL_STATUS_NOT_FOUND;
+    }
+    flash_size = image_size;
+    powered_down = true;
+    erasing = false;
+    return SL_STATUS_OK;
+}
+
+uint32_t history_flash_size(void) {
+    return flash_size;
+}
+
+sl_status_t history_flash_read(uint32_t address, uint8_t *buf, size_t len) {
+    if (address + len > flash_size) {
+        return SL_STATUS_INVALID_RANGE;
+    }
+    if (erasing) {
+        if (sim_clock_ticks() < erase_done_tick) {
+            return SL_STATUS_BUSY;
+        }
+        erasing = false;
+    }
+    wake();
+    memcpy(buf, &image[address], len);
+    sleep_if_idle();
+    return SL_STATUS_OK;
+}
+
+sl_status_t history_flash_program(uint32_t address, const uint8_t *data, size_t len) {
+    if (address + len > flash_size
+        || (address % HISTORY_FLASH_PAGE_SIZE) + len > HISTORY_FLASH_PAGE_SIZE) {
+        return SL_STATUS_INVALID_RANGE;
+    }
+    wake();
+    wait_ready();
+    for (size_t i = 0; i < len; i++) {
+        image[address + i] &= data[i];
+    }
+    write_through(address, (uint32_t)len);
+    programs++;
+    sleep_if_idle();
+    return SL_STATUS_OK;
+}
+
+sl_status_t history_flash_erase_sector(uint32_t address) {
+    if (address >= flash_size) {
+        return SL_STATUS_INVALID_RANGE;
+    }
+    wake();
+    wait_ready();
+    address -= address % HISTORY_FLASH_SECTOR_SIZE;
+    memset(&image[address], 0xFF, HISTORY_FLASH_SECTOR_SIZE);
+    write_through(address, HISTORY_FLASH_SECTOR_SIZE);
+    erases++;
+    erasing = true;
+    erase_done_tick = sim_clock_ticks() + sim_clock_ms_to_ticks(SIM_FLASH_SECTOR_ERASE_MS);
+    return SL_STATUS_OK;
+}
+
+bool history_flash_busy(void) {
+    if (!erasing) {
+        return false;
+    }
+    if (sim_clock_ticks() < erase_done_tick) {
+        return true;
+    }
+    erasing = false;
+    sleep_if_idle();
+    return false;
+}
@@ -0,0 +1,40 @@
+#ifndef HISTORY_FLASH_FILE_H
+#define HISTORY_FLASH_FILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+
+/**************************************************************************/
+/* File-backed NOR flash behind history_flash.                            */
+/*                                                                        */
+/* Emulates the MX25 on the Thunderboard: erased bytes read 0xFF,         */
+/* programming only clears bits and stays within a page, and a sector     */
+/* erase runs for SIM_FLASH_SECTOR_ERASE_MS of virtual time. The image is */
+/* written through to a file, so closing and reopening it is a power      */
+/* cycle of the part. Without an open image history_flash_init() finds no */
+/* flash, as on a board without the part fitted.                          */
+/*                                                                        */
+/* The MX25 driver busy-waits on an erase before any other access. Here   */
+/* such an access completes the erase at once and counts as a stall, so a */
+/* test can check the log never waits on the flash.                       */
+/**************************************************************************/
+
+#define SIM_FLASH_SECTOR_ERASE_MS   40      // MX25R8035F typical tSE
+#define SIM_FLASH_DEFAULT_SIZE      (1UL << 20)
+
+// Open (or create, fully erased) a flash image of size bytes.
+sl_status_t sim_flash_open(const char *path, uint32_t size);
+
+// Flush and close the image. The next history_flash_init() fails.
+void sim_flash_close(void);
+
+uint32_t sim_flash_erases(void);
+uint32_t sim_flash_programs(void);
+// Accesses that had to wait for an erase to finish.
+uint32_t sim_flash_stalls(void);
+
+// Deep power-down as the MX25 driver manages it.
+bool sim_flash_is_powered_down(void);
+
+#endif // HISTORY_FLASH_FILE_H
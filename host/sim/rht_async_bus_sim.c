@@ -0,0 +1,149 @@
+#include <stddef.h>
+#include <stdbool.h>
+#include "sl_sleeptimer.h"
+#include "rht_async_bus.h"
+#include "rht_async_config.h"
+#include "rht_async_bus_sim.h"
+#include "sim_clock.h"
+#include "sim_sensors.h"
+
+#define SI7021_CMD_MEASURE_RH_NO_HOLD     0xF5
+#define SI7021_CMD_READ_TEMP_FROM_RH      0xE0
+
+static sl_sleeptimer_timer_handle_t transfer_timer;
+static rht_async_bus_callback_t pending_callback = NULL;
+static sl_status_t pending_status;
+
+// Sensor state
+static bool measuring = false;          // a measurement was started and not read back
+static uint64_t conversion_done_tick;
+static uint32_t conversion_ms = SIM_RHT_BUS_CONVERSION_MS;
+static uint32_t measured_rh;
+static int32_t measured_temperature;
+
+// Scripted faults and counters
+static uint32_t fail_count = 0;
+static sl_status_t fail_status;
+static uint32_t transfers = 0;
+static uint32_t nacks = 0;
+
+static void store_code(uint8_t *rx, uint32_t code) {
+    rx[0] = (uint8_t)(code >> 8);
+    rx[1] = (uint8_t)code;
+}
+
+// Inverse of the si70xx conversions in rht_async.c, rounded up so the
+// conversion back never reads below the measured value. One code step is
+// about 1.9 m%RH and 2.7 m°C.
+static uint32_t rh_code(uint32_t rh) {
+    return (uint32_t)((((uint64_t)rh + 6000) * 8192 + 15624) / 15625);
+}
+
+static uint32_t temperature_code(int32_t temperature) {
+    return (uint32_t)((((int64_t)temperature + 46850) * 8192 + 21964) / 21965);
+}
+
+// What the sensor answers to a transfer that reached it.
+static sl_status_t sensor_transfer(const uint8_t *tx, size_t tx_len, uint8_t *rx, size_t rx_len) {
+    if (measuring && sim_clock_ticks() < conversion_done_tick) {
+        // Converting: the Si7021 NACKs its address, whatever the command.
+        return SL_STATUS_NOT_READY;
+    }
+    if (tx_len == 1 && tx[0] == SI7021_CMD_MEASURE_RH_NO_HOLD && rx_len == 0) {
+        sim_sensors_get_rht(&measured_rh, &measured_temperature);
+        measuring = true;
+        conversion_done_tick = sim_clock_ticks() + sim_clock_ms_to_ticks(conversion_ms);
+        return SL_STATUS_OK;
+    }
+    if (tx_len == 0 && rx_len == 2) {
+        if (!measuring) {
+            // Nothing to read back.
+            return SL_STATUS_NOT_READY;
+        }
+        measuring = false;
+        store_code(rx, rh_code(measured_rh));
+        return SL_STATUS_OK;
+    }
+    if (tx_len == 1 && tx[0] == SI7021_CMD_READ_TEMP_FROM_RH && rx_len == 2) {
+        store_code(rx, temperature_code(measured_temperature));
+        return SL_STATUS_OK;
+    }
+    return SL_STATUS_IO;
+}
+
+static void transfer_done(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    rht_async_bus_callback_t callback = pending_callback;
+
+    (void)handle;
+    (void)data;
+    pending_callback = NULL;
+    if (pending_status == SL_STATUS_NOT_READY) {
+        nacks++;
+    }
+    callback(pending_status);
+}
+
+/**************************************************************************/
+/* Test Controls                                                          */
+/**************************************************************************/
+void sim_rht_bus_reset(void) {
+    sl_sleeptimer_stop_timer(&transfer_timer);
+    pending_callback = NULL;
+    measuring = false;
+    conversion_ms = SIM_RHT_BUS_CONVERSION_MS;
+    fail_count = 0;
+    transfers = 0;
+    nacks = 0;
+}
+
+void sim_rht_bus_set_conversion_ms(uint32_t ms) {
+    conversion_ms = ms;
+}
+
+void sim_rht_bus_fail_next(uint32_t count, sl_status_t status) {
+    fail_count = count;
+    fail_status = status;
+}
+
+uint32_t sim_rht_bus_transfers(void) {
+    return transfers;
+}
+
+uint32_t sim_rht_bus_nacks(void) {
+    return nacks;
+}
+
+/**************************************************************************/
+/* rht_async_bus                                                          */
+/**************************************************************************/
+sl_status_t rht_async_bus_init(void) {
+    sl_sleeptimer_stop_timer(&transfer_timer);
+    pending_callback = NULL;
+    return SL_STATUS_OK;
+}
+
+sl_status_t rht_async_bus_transfer(uint16_t address,
+                                   const uint8_t *tx,
+                                   size_t tx_len,
+                                   uint8_t *rx,
+                                   size_t rx_len,
+                                   rht_async_bus_callback_t callback) {
+    if ((tx_len == 0 && rx_len == 0) || callback == NULL) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    if (pending_callback != NULL) {
+        return SL_STATUS_BUSY;
+    }
+    transfers++;
+    if (fail_count > 0) {
+        fail_count--;
+        pending_status = fail_status;
+    } else if (address != RHT_ASYNC_I2C_ADDRESS) {
+        // Nobody acknowledges the address.
+        pending_status = SL_STATUS_NOT_READY;
+    } else {
+        pending_status = sensor_transfer(tx, tx_len, rx, rx_len);
+    }
+    pending_callback = callback;
+    return sl_sleeptimer_start_timer(&transfer_timer, SIM_RHT_BUS_TRANSFER_TICKS, transfer_done, NULL, 0, 0);
+}
@@ -0,0 +1,37 @@
+#ifndef RHT_ASYNC_BUS_SIM_H
+#define RHT_ASYNC_BUS_SIM_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+/**************************************************************************/
+/* Simulated I2C bus with an Si7021 behind rht_async_bus.                 */
+/*                                                                        */
+/* The sensor behaves as the datasheet describes for the no-hold master   */
+/* mode: after "measure RH" it NACKs its address until the conversion is  */
+/* done, then returns the RH code, and 0xE0 returns the temperature taken */
+/* with it. Measured values come from sim_sensors. Each transfer          */
+/* completes SIM_RHT_BUS_TRANSFER_TICKS later from the sleeptimer         */
+/* interrupt, as the I2C interrupt would on target. A test can stretch    */
+/* the conversion and script failed transfers.                            */
+/**************************************************************************/
+
+#define SIM_RHT_BUS_TRANSFER_TICKS      1
+#define SIM_RHT_BUS_CONVERSION_MS       20      // default RH + temperature conversion
+
+// Back to the defaults: idle sensor, no scripted faults, counters cleared.
+void sim_rht_bus_reset(void);
+
+// Conversion time of the following measurements.
+void sim_rht_bus_set_conversion_ms(uint32_t ms);
+
+// Complete the next count transfers with status (SL_STATUS_NOT_READY for
+// an address NACK, SL_STATUS_IO for a bus error) whatever the sensor
+// would answer. The sensor does not see a failed transfer.
+void sim_rht_bus_fail_next(uint32_t count, sl_status_t status);
+
+// Transfers started, and those that completed with an address NACK.
+uint32_t sim_rht_bus_transfers(void);
+uint32_t sim_rht_bus_nacks(void);
+
+#endif // RHT_ASYNC_BUS_SIM_H
@@ -0,0 +1,64 @@
+#include "sl_component_catalog.h"
+#include "app.h"
+#include "app_scheduler.h"
+#include "sl_bluetooth.h"
+#include "sl_power_manager.h"
+#include "sim.h"
+
+void sim_init(void) {
+    sim_platform_reset();
+    sim_clock_reset(0);
+    sim_power_reset();
+    sim_sensors_reset();
+    sim_rht_bus_reset();
+    sl_bt_init();
+}
+
+#if !defined(SL_CATALOG_KERNEL_PRESENT)
+// Kernel builds boot and run through the POSIX port (host/posix/sim_kernel.c).
+
+void sim_boot(void) {
+    sim_init();
+    app_init();
+    sim_bt_boot();
+    sim_run_idle();
+}
+
+static bool has_work(void) {
+    return sl_bt_event_pending_len() != 0 || !app_scheduler_is_ok_to_sleep();
+}
+
+void sim_run_until(uint64_t tick) {
+    sim_power_set_horizon(tick);
+    for (;;) {
+        // main(): sl_system_process_action(), app_process_action(),
+        // sl_power_manager_sleep().
+        sl_bt_step();
+        app_process_action();
+
+        if (!has_work()) {
+            uint64_t next;
+            bool due = sim_clock_next_expiry(&next) && next <= sim_clock_ticks();
+            if (!due && sim_clock_ticks() >= tick) {
+                break;
+            }
+        }
+
+        uint32_t sleeps = sim_power_sleeps();
+        sl_power_manager_sleep();
+        if (sim_power_sleeps() == sleeps && !has_work()) {
+            // Sleep refused with nothing to do: the loop spins in EM0
+            // until the next interrupt.
+            sim_clock_step(tick);
+        }
+    }
+}
+
+void sim_run_ms(uint32_t ms) {
+    sim_run_until(sim_clock_ticks() + sim_clock_ms_to_ticks(ms));
+}
+
+void sim_run_idle(void) {
+    sim_run_until(sim_clock_ticks());
+}
+#endif // SL_CATALOG_KERNEL_PRESENT
@@ -0,0 +1,45 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include "history_flash_file.h"
+#include "rht_async_bus_sim.h"
+#include "sim_bt.h"
+#include "sim_clock.h"
+#include "sim_platform.h"
+#include "sim_power.h"
+#include "sim_sensors.h"
+
+/**************************************************************************/
+/* Host simulation of the firmware.                                       */
+/*                                                                        */
+/* The application sources run unchanged against the stand-in SDK         */
+/* headers in host/include. sim_run_until() is main()'s super loop:       */
+/* sl_bt_step(), app_process_action(), sl_power_manager_sleep(), with     */
+/* sleep moving the virtual clock to the next timer. A test boots the     */
+/* firmware with sim_boot(), queues stack events with sim_bt_*(), runs    */
+/* virtual time and checks what was sent.                                 */
+/*                                                                        */
+/* Kernel builds (SL_CATALOG_KERNEL_PRESENT) run the same interface on    */
+/* the POSIX port in host/posix: the tasks are threads, and the run loop  */
+/* is the idle task, moving the clock only once every task is blocked.    */
+/* Events the test queues reach the Bluetooth event task when it next     */
+/* calls sim_run_*(), so the same test runs on both builds.               */
+/**************************************************************************/
+
+// Reset the clock, the stack and the simulated peripherals.
+void sim_init(void);
+
+// sim_init(), app_init(), then the boot event, run to idle.
+void sim_boot(void);
+
+// Run the super loop until the clock reaches tick and nothing is left to
+// do at that time.
+void sim_run_until(uint64_t tick);
+
+void sim_run_ms(uint32_t ms);
+
+// Process everything pending without moving the clock.
+void sim_run_idle(void);
+
+#endif // SIM_H
@@ -0,0 +1,790 @@
+#include <string.h>
+#include "em_core.h"
+#include "gatt_db.h"
+#include "sl_bluetooth.h"
+#include "sim_bt.h"
+#include "sim_clock.h"
+
+#define MAX_CONNECTIONS     8
+#define MAX_CCCDS           16
+#define NVM_KEYS            8
+#define NVM_VALUE_MAX       64
+#define DEVICE_NAME         "Thunderboard"
+#define ATTRIBUTES          8
+#define ATTRIBUTE_VALUE_MAX 32
+
+typedef struct {
+    bool open;
+    uint8_t handle;
+    uint16_t mtu;
+    int32_t credits;
+    uint16_t cccd_characteristic[MAX_CCCDS];
+    uint16_t cccd_flags[MAX_CCCDS];
+    bool parameters_requested;
+    uint16_t min_interval;
+    uint16_t max_interval;
+    uint16_t latency;
+} sim_connection_t;
+
+typedef struct {
+    uint16_t attribute;             // 0 when unused
+    size_t len;
+    uint8_t value[ATTRIBUTE_VALUE_MAX];
+} attribute_t;
+
+typedef struct {
+    bool used;
+    uint16_t key;
+    size_t len;
+    uint8_t value[NVM_VALUE_MAX];
+} nvm_entry_t;
+
+static sl_bt_msg_t queue[SIM_BT_QUEUE_SIZE];
+static uint32_t queue_head = 0;       // next to pop
+static uint32_t queue_count = 0;
+static uint32_t pending_signals = 0;
+static bool signal_queued = false;
+static sim_bt_event_callback_t event_callback = NULL;
+
+static sim_connection_t connections[MAX_CONNECTIONS];
+static attribute_t attributes[ATTRIBUTES];
+static nvm_entry_t nvm[NVM_KEYS];
+static sim_bt_packet_t sent[SIM_BT_SENT_SIZE];
+static uint32_t sent_total = 0;
+static sl_status_t forced[SIM_BT_CMD_COUNT];
+static uint32_t calls[SIM_BT_CMD_COUNT];
+static uint8_t advertising_sets = 0;
+static bool advertising = false;
+
+/**************************************************************************/
+/* Event Queue                                                            */
+/**************************************************************************/
+size_t sim_bt_payload_len(const sl_bt_msg_t *msg) {
+    switch (SL_BT_MSG_ID(msg->header)) {
+    case sl_bt_evt_system_boot_id:
+        return sizeof(sl_bt_evt_system_boot_t);
+    case sl_bt_evt_system_external_signal_id:
+        return sizeof(sl_bt_evt_system_external_signal_t);
+    case sl_bt_evt_connection_opened_id:
+        return sizeof(sl_bt_evt_connection_opened_t);
+    case sl_bt_evt_connection_parameters_id:
+        return sizeof(sl_bt_evt_connection_parameters_t);
+    case sl_bt_evt_connection_phy_status_id:
+        return sizeof(sl_bt_evt_connection_phy_status_t);
+    case sl_bt_evt_connection_closed_id:
+        return sizeof(sl_bt_evt_connection_closed_t);
+    case sl_bt_evt_gatt_mtu_exchanged_id:
+        return sizeof(sl_bt_evt_gatt_mtu_exchanged_t);
+    case sl_bt_evt_gatt_server_attribute_value_id:
+        return sizeof(sl_bt_evt_gatt_server_attribute_value_t) + msg->data.evt_gatt_server_attribute_value.value.len;
+    case sl_bt_evt_gatt_server_user_read_request_id:
+        return sizeof(sl_bt_evt_gatt_server_user_read_request_t);
+    case sl_bt_evt_gatt_server_user_write_request_id:
+        return sizeof(sl_bt_evt_gatt_server_user_write_request_t) + msg->data.evt_gatt_server_user_write_request.value.len;
+    case sl_bt_evt_gatt_server_characteristic_status_id:
+        return sizeof(sl_bt_evt_gatt_server_characteristic_status_t);
+    default:
+        return 0;
+    }
+}
+
+static sl_status_t enqueue(uint32_t id, const sl_bt_msg_t *msg) {
+    CORE_DECLARE_IRQ_STATE;
+    sl_bt_msg_t *slot;
+    size_t len;
+
+    CORE_ENTER_CRITICAL();
+    if (queue_count == SIM_BT_QUEUE_SIZE) {
+        CORE_EXIT_CRITICAL();
+        return SL_STATUS_FULL;
+    }
+    slot = &queue[(queue_head + queue_count) % SIM_BT_QUEUE_SIZE];
+    *slot = *msg;
+    slot->header = id;
+    len = sim_bt_payload_len(slot);
+    slot->header |= ((len & 0xFF) << 8) | ((len >> 8) & 0x7);
+    queue_count++;
+    if (event_callback != NULL) {
+        event_callback();
+    }
+    CORE_EXIT_CRITICAL();
+    return SL_STATUS_OK;
+}
+
+void sim_bt_set_event_callback(sim_bt_event_callback_t callback) {
+    event_callback = callback;
+}
+
+sl_status_t sl_bt_external_signal(uint32_t signals) {
+    CORE_DECLARE_IRQ_STATE;
+    sl_status_t sc = SL_STATUS_OK;
+    sl_bt_msg_t msg = { 0 };
+
+    CORE_ENTER_CRITICAL();
+    pending_signals |= signals;
+    if (!signal_queued) {
+        // The bits are collected when the event is popped.
+        sc = enqueue(sl_bt_evt_system_external_signal_id, &msg);
+        signal_queued = (sc == SL_STATUS_OK);
+    }
+    CORE_EXIT_CRITICAL();
+    return sc;
+}
+
+uint32_t sl_bt_event_pending_len(void) {
+    CORE_DECLARE_IRQ_STATE;
+    uint32_t len = 0;
+
+    CORE_ENTER_CRITICAL();
+    if (queue_count > 0) {
+        len = SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(queue[queue_head].header);
+    }
+    CORE_EXIT_CRITICAL();
+    return len;
+}
+
+sl_status_t sl_bt_pop_event(sl_bt_msg_t *event) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_CRITICAL();
+    if (queue_count == 0) {
+        CORE_EXIT_CRITICAL();
+        return SL_STATUS_EMPTY;
+    }
+    *event = queue[queue_head];
+    queue_head = (queue_head + 1) % SIM_BT_QUEUE_SIZE;
+    queue_count--;
+    if (SL_BT_MSG_ID(event->header) == sl_bt_evt_system_external_signal_id) {
+        event->data.evt_system_external_signal.extsignals = pending_signals;
+        pending_signals = 0;
+        signal_queued = false;
+    }
+    CORE_EXIT_CRITICAL();
+    return SL_STATUS_OK;
+}
+
+void sl_bt_run(void) {
+}
+
+void sl_bt_priority_handle(void) {
+}
+
+// sl_bt_init() (autogen/sl_bluetooth.c) initialises and starts the stack:
+// forget every event, link, stored value and forced result.
+sl_status_t sl_bt_stack_init(void) {
+    queue_head = 0;
+    queue_count = 0;
+    pending_signals = 0;
+    signal_queued = false;
+    memset(connections, 0, sizeof(connections));
+    memset(attributes, 0, sizeof(attributes));
+    memset(nvm, 0, sizeof(nvm));
+    memset(forced, 0, sizeof(forced));
+    memset(calls, 0, sizeof(calls));
+    sent_total = 0;
+    advertising_sets = 0;
+    advertising = false;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sli_bt_system_start_bluetooth(void) {
+    return SL_STATUS_OK;
+}
+
+// The in-place OTA DFU component only acts on writes to OTA Control, which
+// reboot into the bootloader; the simulated stack never raises those.
+void sl_bt_in_place_ota_dfu_on_event(sl_bt_msg_t *evt) {
+    (void)evt;
+}
+
+/**************************************************************************/
+/* Connections                                                            */
+/**************************************************************************/
+static sim_connection_t *find_connection(uint8_t handle) {
+    for (int i = 0; i < MAX_CONNECTIONS; i++) {
+        if (connections[i].open && connections[i].handle == handle) {
+            return &connections[i];
+        }
+    }
+    return NULL;
+}
+
+static uint16_t cccd_flags(const sim_connection_t *conn, uint16_t characteristic) {
+    for (int i = 0; i < MAX_CCCDS; i++) {
+        if (conn->cccd_characteristic[i] == characteristic) {
+            return conn->cccd_flags[i];
+        }
+    }
+    return 0;
+}
+
+static void set_cccd(sim_connection_t *conn, uint16_t characteristic, uint16_t flags) {
+    int free_slot = -1;
+
+    for (int i = 0; i < MAX_CCCDS; i++) {
+        if (conn->cccd_characteristic[i] == characteristic) {
+            conn->cccd_flags[i] = flags;
+            return;
+        }
+        if (conn->cccd_characteristic[i] == 0 && free_slot < 0) {
+            free_slot = i;
+        }
+    }
+    if (free_slot >= 0) {
+        conn->cccd_characteristic[free_slot] = characteristic;
+        conn->cccd_flags[free_slot] = flags;
+    }
+}
+
+/**************************************************************************/
+/* Event Builders                                                         */
+/**************************************************************************/
+// The stack's own view of the link changes as it raises the event.
+static sl_status_t apply(const sl_bt_msg_t *msg) {
+    sim_connection_t *conn;
+
+    switch (SL_BT_MSG_ID(msg->header)) {
+    case sl_bt_evt_connection_opened_id:
+        if (find_connection(msg->data.evt_connection_opened.connection) != NULL) {
+            return SL_STATUS_ALREADY_EXISTS;
+        }
+        for (int i = 0; i < MAX_CONNECTIONS; i++) {
+            if (!connections[i].open) {
+                memset(&connections[i], 0, sizeof(connections[i]));
+                connections[i].open = true;
+                connections[i].handle = msg->data.evt_connection_opened.connection;
+                connections[i].mtu = SIM_BT_DEFAULT_MTU;
+                connections[i].credits = -1;
+                // A connectable advertiser stops when a central connects.
+                advertising = false;
+                return SL_STATUS_OK;
+            }
+        }
+        return SL_STATUS_NO_MORE_RESOURCE;
+
+    case sl_bt_evt_connection_closed_id:
+        conn = find_connection(msg->data.evt_connection_closed.connection);
+        if (conn == NULL) {
+            return SL_STATUS_NOT_FOUND;
+        }
+        conn->open = false;
+        return SL_STATUS_OK;
+
+    case sl_bt_evt_gatt_mtu_exchanged_id:
+        conn = find_connection(msg->data.evt_gatt_mtu_exchanged.connection);
+        if (conn == NULL) {
+            return SL_STATUS_NOT_FOUND;
+        }
+        conn->mtu = msg->data.evt_gatt_mtu_exchanged.mtu;
+        return SL_STATUS_OK;
+
+    case sl_bt_evt_gatt_server_characteristic_status_id:
+        conn = find_connection(msg->data.evt_gatt_server_characteristic_status.connection);
+        if (conn == NULL) {
+            return SL_STATUS_NOT_FOUND;
+        }
+        if (msg->data.evt_gatt_server_characteristic_status.status_flags & sl_bt_gatt_server_client_config) {
+            set_cccd(conn,
+                     msg->data.evt_gatt_server_characteristic_status.characteristic,
+                     msg->data.evt_gatt_server_characteristic_status.client_config_flags);
+        }
+        return SL_STATUS_OK;
+
+    default:
+        return SL_STATUS_OK;
+    }
+}
+
+sl_status_t sim_bt_push(const sl_bt_msg_t *msg) {
+    sl_status_t sc = apply(msg);
+
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    return enqueue(SL_BT_MSG_ID(msg->header), msg);
+}
+
+sl_status_t sim_bt_boot(void) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_system_boot_id };
+
+    msg.data.evt_system_boot.major = 7;
+    msg.data.evt_system_boot.minor = 1;
+    return sim_bt_push(&msg);
+}
+
+sl_status_t sim_bt_open(uint8_t connection) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_connection_opened_id };
+
+    msg.data.evt_connection_opened.connection = connection;
+    msg.data.evt_connection_opened.address.addr[0] = connection;
+    return sim_bt_push(&msg);
+}
+
+sl_status_t sim_bt_close(uint8_t connection, uint16_t reason) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_connection_closed_id };
+
+    msg.data.evt_connection_closed.connection = connection;
+    msg.data.evt_connection_closed.reason = reason;
+    return sim_bt_push(&msg);
+}
+
+sl_status_t sim_bt_parameters(uint8_t connection, uint16_t interval, uint16_t latency, uint16_t timeout) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_connection_parameters_id };
+
+    msg.data.evt_connection_parameters.connection = connection;
+    msg.data.evt_connection_parameters.interval = interval;
+    msg.data.evt_connection_parameters.latency = latency;
+    msg.data.evt_connection_parameters.timeout = timeout;
+    return sim_bt_push(&msg);
+}
+
+sl_status_t sim_bt_phy(uint8_t connection, uint8_t phy) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_connection_phy_status_id };
+
+    msg.data.evt_connection_phy_status.connection = connection;
+    msg.data.evt_connection_phy_status.phy = phy;
+    return sim_bt_push(&msg);
+}
+
+sl_status_t sim_bt_mtu(uint8_t connection, uint16_t mtu) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_gatt_mtu_exchanged_id };
+
+    msg.data.evt_gatt_mtu_exchanged.connection = connection;
+    msg.data.evt_gatt_mtu_exchanged.mtu = mtu;
+    return sim_bt_push(&msg);
+}
+
+sl_status_t sim_bt_subscribe(uint8_t connection, uint16_t characteristic, uint16_t client_config_flags) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_gatt_server_characteristic_status_id };
+
+    msg.data.evt_gatt_server_characteristic_status.connection = connection;
+    msg.data.evt_gatt_server_characteristic_status.characteristic = characteristic;
+    msg.data.evt_gatt_server_characteristic_status.status_flags = sl_bt_gatt_server_client_config;
+    msg.data.evt_gatt_server_characteristic_status.client_config_flags = client_config_flags;
+    return sim_bt_push(&msg);
+}
+
+sl_status_t sim_bt_read(uint8_t connection, uint16_t characteristic) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_gatt_server_user_read_request_id };
+
+    msg.data.evt_gatt_server_user_read_request.connection = connection;
+    msg.data.evt_gatt_server_user_read_request.characteristic = characteristic;
+    return sim_bt_push(&msg);
+}
+
+sl_status_t sim_bt_write(uint8_t connection,
+                         uint16_t characteristic,
+                         uint8_t att_opcode,
+                         const uint8_t *data,
+                         size_t len) {
+    sl_bt_msg_t msg = { .header = sl_bt_evt_gatt_server_user_write_request_id };
+
+    if (len > SIM_BT_VALUE_MAX) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    msg.data.evt_gatt_server_user_write_request.connection = connection;
+    msg.data.evt_gatt_server_user_write_request.characteristic = characteristic;
+    msg.data.evt_gatt_server_user_write_request.att_opcode = att_opcode;
+    msg.data.evt_gatt_server_user_write_request.value.len = (uint8_t)len;
+    memcpy(msg.data.evt_gatt_server_user_write_request.value.data, data, len);
+    return sim_bt_push(&msg);
+}
+
+/**************************************************************************/
+/* Stack Behaviour                                                        */
+/**************************************************************************/
+void sim_bt_set_tx_credits(uint8_t connection, int32_t credits) {
+    sim_connection_t *conn = find_connection(connection);
+
+    if (conn != NULL) {
+        conn->credits = credits;
+    }
+}
+
+void sim_bt_set_result(sim_bt_command_t command, sl_status_t status) {
+    forced[command] = status;
+}
+
+uint32_t sim_bt_calls(sim_bt_command_t command) {
+    return calls[command];
+}
+
+static sl_status_t command(sim_bt_command_t cmd) {
+    calls[cmd]++;
+    return forced[cmd];
+}
+
+/**************************************************************************/
+/* Recorded Output                                                        */
+/**************************************************************************/
+static void record(sim_bt_packet_type_t type,
+                   uint8_t connection,
+                   uint16_t characteristic,
+                   uint8_t att_errcode,
+                   size_t len,
+                   const uint8_t *data) {
+    sim_bt_packet_t *packet = &sent[sent_total % SIM_BT_SENT_SIZE];
+
+    packet->type = type;
+    packet->connection = connection;
+    packet->characteristic = characteristic;
+    packet->att_errcode = att_errcode;
+    packet->len = (uint16_t)len;
+    if (len > 0) {
+        memcpy(packet->data, data, len);
+    }
+    packet->tick = sim_clock_ticks();
+    sent_total++;
+}
+
+uint32_t sim_bt_sent_count(void) {
+    return sent_total;
+}
+
+const sim_bt_packet_t *sim_bt_sent(uint32_t index) {
+    uint32_t kept = (sent_total < SIM_BT_SENT_SIZE) ? sent_total : SIM_BT_SENT_SIZE;
+
+    if (index >= kept) {
+        return NULL;
+    }
+    return &sent[(sent_total - kept + index) % SIM_BT_SENT_SIZE];
+}
+
+static bool matches(const sim_bt_packet_t *packet,
+                    sim_bt_packet_type_t type,
+                    uint8_t connection,
+                    uint16_t characteristic) {
+    return packet->type == type
+           && packet->connection == connection
+           && packet->characteristic == characteristic;
+}
+
+const sim_bt_packet_t *sim_bt_last(sim_bt_packet_type_t type, uint8_t connection, uint16_t characteristic) {
+    uint32_t kept = (sent_total < SIM_BT_SENT_SIZE) ? sent_total : SIM_BT_SENT_SIZE;
+
+    for (uint32_t i = kept; i > 0; i--) {
+        const sim_bt_packet_t *packet = sim_bt_sent(i - 1);
+        if (matches(packet, type, connection, characteristic)) {
+            return packet;
+        }
+    }
+    return NULL;
+}
+
+uint32_t sim_bt_count(sim_bt_packet_type_t type, uint8_t connection, uint16_t characteristic) {
+    uint32_t kept = (sent_total < SIM_BT_SENT_SIZE) ? sent_total : SIM_BT_SENT_SIZE;
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < kept; i++) {
+        if (matches(sim_bt_sent(i), type, connection, characteristic)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void sim_bt_clear_sent(void) {
+    sent_total = 0;
+}
+
+bool sim_bt_requested_parameters(uint8_t connection, uint16_t *min_interval, uint16_t *max_interval, uint16_t *latency) {
+    sim_connection_t *conn = find_connection(connection);
+
+    if (conn == NULL || !conn->parameters_requested) {
+        return false;
+    }
+    *min_interval = conn->min_interval;
+    *max_interval = conn->max_interval;
+    *latency = conn->latency;
+    return true;
+}
+
+bool sim_bt_is_advertising(void) {
+    return advertising;
+}
+
+/**************************************************************************/
+/* GATT Server Commands                                                   */
+/**************************************************************************/
+sl_status_t sl_bt_gatt_server_send_notification(uint8_t connection,
+                                                uint16_t characteristic,
+                                                size_t value_len,
+                                                const uint8_t *value) {
+    sim_connection_t *conn = find_connection(connection);
+
+    if (conn == NULL) {
+        return SL_STATUS_NOT_FOUND;
+    }
+    if (!(cccd_flags(conn, characteristic) & gatt_notification)) {
+        return SL_STATUS_INVALID_STATE;
+    }
+    if (value_len > (size_t)(conn->mtu - 3)) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    if (conn->credits == 0) {
+        return SL_STATUS_NO_MORE_RESOURCE;
+    }
+    if (conn->credits > 0) {
+        conn->credits--;
+    }
+    record(SIM_BT_NOTIFICATION, connection, characteristic, 0, value_len, value);
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_gatt_server_send_user_read_response(uint8_t connection,
+                                                      uint16_t characteristic,
+                                                      uint8_t att_errorcode,
+                                                      size_t value_len,
+                                                      const uint8_t *value,
+                                                      uint16_t *sent_len) {
+    sim_connection_t *conn = find_connection(connection);
+    size_t len;
+
+    if (conn == NULL) {
+        return SL_STATUS_NOT_FOUND;
+    }
+    // Long values are cut to the first ATT_MTU - 1 bytes, as a Read
+    // Response carries no more.
+    len = (value_len > (size_t)(conn->mtu - 1)) ? (size_t)(conn->mtu - 1) : value_len;
+    record(SIM_BT_READ_RESPONSE, connection, characteristic, att_errorcode, len, value);
+    if (sent_len != NULL) {
+        *sent_len = (uint16_t)len;
+    }
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_gatt_server_send_user_write_response(uint8_t connection,
+                                                       uint16_t characteristic,
+                                                       uint8_t att_errorcode) {
+    if (find_connection(connection) == NULL) {
+        return SL_STATUS_NOT_FOUND;
+    }
+    record(SIM_BT_WRITE_RESPONSE, connection, characteristic, att_errorcode, 0, NULL);
+    return SL_STATUS_OK;
+}
+
+// Values written by the application; the device name is the GATT
+// database's constant value.
+static attribute_t *find_attribute(uint16_t attribute) {
+    for (size_t i = 0; i < ATTRIBUTES; i++) {
+        if (attributes[i].attribute == attribute) {
+            return &attributes[i];
+        }
+    }
+    return NULL;
+}
+
+sl_status_t sl_bt_gatt_server_write_attribute_value(uint16_t attribute,
+                                                    uint16_t offset,
+                                                    size_t value_len,
+                                                    const uint8_t *value) {
+    attribute_t *entry = find_attribute(attribute);
+
+    if (entry == NULL) {
+        entry = find_attribute(0);
+        if (entry == NULL) {
+            return SL_STATUS_NO_MORE_RESOURCE;
+        }
+        entry->attribute = attribute;
+        entry->len = 0;
+    }
+    if (offset > entry->len || offset + value_len > ATTRIBUTE_VALUE_MAX) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    memcpy(&entry->value[offset], value, value_len);
+    entry->len = offset + value_len;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_gatt_server_read_attribute_value(uint16_t attribute,
+                                                   uint16_t offset,
+                                                   size_t max_value_size,
+                                                   size_t *value_len,
+                                                   uint8_t *value) {
+    const attribute_t *entry = find_attribute(attribute);
+    const uint8_t *data = entry ? entry->value : (const uint8_t *)DEVICE_NAME;
+    size_t len = entry ? entry->len : sizeof(DEVICE_NAME) - 1;
+
+    if (entry == NULL && attribute != gattdb_device_name) {
+        return SL_STATUS_NOT_FOUND;
+    }
+    if (offset > len) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    len -= offset;
+    if (len > max_value_size) {
+        len = max_value_size;
+    }
+    memcpy(value, data + offset, len);
+    *value_len = len;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_system_get_identity_address(bd_addr *address, uint8_t *type) {
+    static const bd_addr identity = { { 0x5C, 0x3F, 0x42, 0x57, 0x0B, 0x00 } };
+
+    *address = identity;
+    *type = 0;      // public
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_connection_set_parameters(uint8_t connection,
+                                            uint16_t min_interval,
+                                            uint16_t max_interval,
+                                            uint16_t latency,
+                                            uint16_t timeout,
+                                            uint16_t min_ce_length,
+                                            uint16_t max_ce_length) {
+    sim_connection_t *conn = find_connection(connection);
+    sl_status_t sc = command(SIM_BT_CMD_SET_PARAMETERS);
+
+    (void)timeout;
+    (void)min_ce_length;
+    (void)max_ce_length;
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    if (conn == NULL) {
+        return SL_STATUS_NOT_FOUND;
+    }
+    conn->parameters_requested = true;
+    conn->min_interval = min_interval;
+    conn->max_interval = max_interval;
+    conn->latency = latency;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_connection_set_preferred_phy(uint8_t connection, uint8_t preferred_phy, uint8_t accepted_phy) {
+    sl_status_t sc = command(SIM_BT_CMD_SET_PREFERRED_PHY);
+
+    (void)preferred_phy;
+    (void)accepted_phy;
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    return (find_connection(connection) != NULL) ? SL_STATUS_OK : SL_STATUS_NOT_FOUND;
+}
+
+/**************************************************************************/
+/* Advertiser Commands                                                    */
+/**************************************************************************/
+sl_status_t sl_bt_advertiser_create_set(uint8_t *handle) {
+    *handle = advertising_sets++;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_advertiser_set_timing(uint8_t advertising_set,
+                                        uint32_t interval_min,
+                                        uint32_t interval_max,
+                                        uint16_t duration,
+                                        uint8_t maxevents) {
+    (void)interval_min;
+    (void)interval_max;
+    (void)duration;
+    (void)maxevents;
+    return (advertising_set < advertising_sets) ? SL_STATUS_OK : SL_STATUS_INVALID_PARAMETER;
+}
+
+sl_status_t sl_bt_advertiser_stop(uint8_t advertising_set) {
+    (void)advertising_set;
+    advertising = false;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_legacy_advertiser_generate_data(uint8_t advertising_set, uint8_t discover) {
+    (void)discover;
+    return (advertising_set < advertising_sets) ? SL_STATUS_OK : SL_STATUS_INVALID_PARAMETER;
+}
+
+sl_status_t sl_bt_legacy_advertiser_set_data(uint8_t advertising_set,
+                                             uint8_t type,
+                                             size_t data_len,
+                                             const uint8_t *data) {
+    (void)type;
+    (void)data;
+    if (advertising_set >= advertising_sets || data_len > 31) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_legacy_advertiser_start(uint8_t advertising_set, uint8_t connect) {
+    sl_status_t sc = command(SIM_BT_CMD_ADVERTISER_START);
+
+    (void)connect;
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    if (advertising_set >= advertising_sets) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    advertising = true;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_extended_advertiser_generate_data(uint8_t advertising_set, uint8_t discover) {
+    (void)discover;
+    return (advertising_set < advertising_sets) ? SL_STATUS_OK : SL_STATUS_INVALID_PARAMETER;
+}
+
+sl_status_t sl_bt_periodic_advertiser_set_data(uint8_t advertising_set, size_t data_len, const uint8_t *data) {
+    (void)data;
+    if (advertising_set >= advertising_sets || data_len > 1650) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_periodic_advertiser_start(uint8_t advertising_set,
+                                            uint16_t interval_min,
+                                            uint16_t interval_max,
+                                            uint32_t flags) {
+    (void)interval_min;
+    (void)interval_max;
+    (void)flags;
+    return (advertising_set < advertising_sets) ? SL_STATUS_OK : SL_STATUS_INVALID_PARAMETER;
+}
+
+/**************************************************************************/
+/* NVM Commands                                                           */
+/**************************************************************************/
+sl_status_t sl_bt_nvm_save(uint16_t key, size_t value_len, const uint8_t *value) {
+    sl_status_t sc = command(SIM_BT_CMD_NVM_SAVE);
+    nvm_entry_t *slot = NULL;
+
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    if (value_len > NVM_VALUE_MAX) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    for (int i = 0; i < NVM_KEYS; i++) {
+        if (nvm[i].used && nvm[i].key == key) {
+            slot = &nvm[i];
+            break;
+        }
+        if (!nvm[i].used && slot == NULL) {
+            slot = &nvm[i];
+        }
+    }
+    if (slot == NULL) {
+        return SL_STATUS_FULL;
+    }
+    slot->used = true;
+    slot->key = key;
+    slot->len = value_len;
+    memcpy(slot->value, value, value_len);
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_nvm_load(uint16_t key, size_t max_value_size, size_t *value_len, uint8_t *value) {
+    for (int i = 0; i < NVM_KEYS; i++) {
+        if (nvm[i].used && nvm[i].key == key) {
+            size_t len = (nvm[i].len < max_value_size) ? nvm[i].len : max_value_size;
+            memcpy(value, nvm[i].value, len);
+            *value_len = len;
+            return SL_STATUS_OK;
+        }
+    }
+    return SL_STATUS_NOT_FOUND;
+}
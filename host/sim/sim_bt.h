@@ -0,0 +1,106 @@
+#ifndef SIM_BT_H
+#define SIM_BT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sl_bluetooth.h"
+
+/**************************************************************************/
+/* Simulated Bluetooth stack.                                             */
+/*                                                                        */
+/* Events queued here come out of sl_bt_pop_event() in order, as on       */
+/* target. sl_bt_external_signal() bits accumulate into one pending       */
+/* external signal event. Notifications and read/write responses are      */
+/* recorded for the test to inspect. The stack checks what the SDK        */
+/* would: notifications need an open connection, an enabled CCCD and a    */
+/* value within ATT_MTU - 3.                                              */
+/**************************************************************************/
+
+#define SIM_BT_QUEUE_SIZE       64
+#define SIM_BT_SENT_SIZE        256     // most recent packets kept
+#define SIM_BT_VALUE_MAX        250
+#define SIM_BT_DEFAULT_MTU      23
+
+typedef enum {
+    SIM_BT_NOTIFICATION,
+    SIM_BT_READ_RESPONSE,
+    SIM_BT_WRITE_RESPONSE
+} sim_bt_packet_type_t;
+
+typedef struct {
+    sim_bt_packet_type_t type;
+    uint8_t connection;
+    uint16_t characteristic;
+    uint8_t att_errcode;            // responses only
+    uint16_t len;
+    uint8_t data[SIM_BT_VALUE_MAX];
+    uint64_t tick;
+} sim_bt_packet_t;
+
+// Commands whose result a test can force.
+typedef enum {
+    SIM_BT_CMD_SET_PARAMETERS,
+    SIM_BT_CMD_SET_PREFERRED_PHY,
+    SIM_BT_CMD_ADVERTISER_START,
+    SIM_BT_CMD_NVM_SAVE,
+    SIM_BT_CMD_COUNT
+} sim_bt_command_t;
+
+/**************************************************************************/
+/* Events                                                                 */
+/**************************************************************************/
+// Queue a message as if the stack raised it. Connection, MTU and CCCD
+// events update the stack's view of the link first. The length bits of
+// the header are filled in from the event.
+sl_status_t sim_bt_push(const sl_bt_msg_t *msg);
+// Payload length of an event, 0 for IDs the simulator does not model.
+size_t sim_bt_payload_len(const sl_bt_msg_t *msg);
+// Called from the queueing context, with interrupts masked, each time an
+// event is queued. The POSIX port wakes its Bluetooth event task with it.
+typedef void (*sim_bt_event_callback_t)(void);
+void sim_bt_set_event_callback(sim_bt_event_callback_t callback);
+
+sl_status_t sim_bt_boot(void);
+sl_status_t sim_bt_open(uint8_t connection);
+sl_status_t sim_bt_close(uint8_t connection, uint16_t reason);
+sl_status_t sim_bt_parameters(uint8_t connection, uint16_t interval, uint16_t latency, uint16_t timeout);
+sl_status_t sim_bt_phy(uint8_t connection, uint8_t phy);
+sl_status_t sim_bt_mtu(uint8_t connection, uint16_t mtu);
+sl_status_t sim_bt_subscribe(uint8_t connection, uint16_t characteristic, uint16_t client_config_flags);
+sl_status_t sim_bt_read(uint8_t connection, uint16_t characteristic);
+sl_status_t sim_bt_write(uint8_t connection,
+                         uint16_t characteristic,
+                         uint8_t att_opcode,
+                         const uint8_t *data,
+                         size_t len);
+
+/**************************************************************************/
+/* Stack Behaviour                                                        */
+/**************************************************************************/
+// Notifications the stack still takes on a connection before it answers
+// SL_STATUS_NO_MORE_RESOURCE; -1 (the default) for no limit.
+void sim_bt_set_tx_credits(uint8_t connection, int32_t credits);
+
+// Force the result of the next calls of a command; SL_STATUS_OK restores
+// the simulated behaviour.
+void sim_bt_set_result(sim_bt_command_t command, sl_status_t status);
+uint32_t sim_bt_calls(sim_bt_command_t command);
+
+/**************************************************************************/
+/* Recorded Output                                                        */
+/**************************************************************************/
+// Packets sent since the last clear, and one of them by index (oldest
+// kept first). Only the last SIM_BT_SENT_SIZE are kept.
+uint32_t sim_bt_sent_count(void);
+const sim_bt_packet_t *sim_bt_sent(uint32_t index);
+// Most recent matching packet, NULL if none.
+const sim_bt_packet_t *sim_bt_last(sim_bt_packet_type_t type, uint8_t connection, uint16_t characteristic);
+uint32_t sim_bt_count(sim_bt_packet_type_t type, uint8_t connection, uint16_t characteristic);
+void sim_bt_clear_sent(void);
+
+// Connection parameters last requested for a connection.
+bool sim_bt_requested_parameters(uint8_t connection, uint16_t *min_interval, uint16_t *max_interval, uint16_t *latency);
+bool sim_bt_is_advertising(void);
+
+#endif // SIM_BT_H
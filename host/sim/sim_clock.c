@@ -0,0 +1,338 @@
+#include <stddef.h>
+#include "em_core.h"
+#include "em_device.h"
+#include "sl_sleeptimer.h"
+#include "sim_clock.h"
+#include "sim_platform.h"
+
+static uint64_t now = 0;
+static uint64_t start = 0;
+static sl_sleeptimer_timer_handle_t *timers = NULL;   // sorted by expiry
+
+/**************************************************************************/
+/* Timer List                                                             */
+/**************************************************************************/
+static bool unlink_timer(sl_sleeptimer_timer_handle_t *handle) {
+    for (sl_sleeptimer_timer_handle_t **link = &timers; *link != NULL; link = &(*link)->next) {
+        if (*link == handle) {
+            *link = handle->next;
+            handle->next = NULL;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void insert_timer(sl_sleeptimer_timer_handle_t *handle) {
+    sl_sleeptimer_timer_handle_t **link = &timers;
+
+    // Timers due at the same tick fire in the order they were started.
+    while (*link != NULL && (*link)->expiry <= handle->expiry) {
+        link = &(*link)->next;
+    }
+    handle->next = *link;
+    *link = handle;
+}
+
+static bool is_running(const sl_sleeptimer_timer_handle_t *handle) {
+    for (const sl_sleeptimer_timer_handle_t *t = timers; t != NULL; t = t->next) {
+        if (t == handle) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static sl_status_t start_timer(sl_sleeptimer_timer_handle_t *handle,
+                               uint32_t timeout,
+                               uint32_t period,
+                               sl_sleeptimer_timer_callback_t callback,
+                               void *callback_data,
+                               uint8_t priority,
+                               uint16_t option_flags) {
+    CORE_DECLARE_IRQ_STATE;
+
+    if (handle == NULL) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    CORE_ENTER_CRITICAL();
+    if (is_running(handle)) {
+        CORE_EXIT_CRITICAL();
+        return SL_STATUS_NOT_READY;
+    }
+    handle->callback = callback;
+    handle->callback_data = callback_data;
+    handle->priority = priority;
+    handle->option_flags = option_flags;
+    handle->timeout_periodic = period;
+    handle->expiry = now + timeout;
+    insert_timer(handle);
+    CORE_EXIT_CRITICAL();
+    return SL_STATUS_OK;
+}
+
+/**************************************************************************/
+/* Virtual Clock                                                          */
+/**************************************************************************/
+void sim_clock_reset(uint64_t tick) {
+    while (timers != NULL) {
+        unlink_timer(timers);
+    }
+    now = tick;
+    start = tick;
+}
+
+uint64_t sim_clock_ticks(void) {
+    return sl_sleeptimer_get_tick_count64();
+}
+
+uint32_t sim_clock_ms(void) {
+    return (uint32_t)(((sim_clock_ticks() - start) * 1000) / SIM_CLOCK_FREQUENCY);
+}
+
+uint64_t sim_clock_ms_to_ticks(uint32_t ms) {
+    return ((uint64_t)ms * SIM_CLOCK_FREQUENCY) / 1000;
+}
+
+bool sim_clock_next_expiry(uint64_t *tick) {
+    CORE_DECLARE_IRQ_STATE;
+    bool running;
+
+    CORE_ENTER_CRITICAL();
+    running = timers != NULL;
+    if (running) {
+        *tick = timers->expiry;
+    }
+    CORE_EXIT_CRITICAL();
+    return running;
+}
+
+static void set_time(uint64_t tick) {
+    if (tick > now) {
+        sim_platform_elapse(tick - now);
+        now = tick;
+    }
+}
+
+bool sim_clock_wait(uint64_t limit) {
+    CORE_DECLARE_IRQ_STATE;
+    bool due;
+
+    CORE_ENTER_CRITICAL();
+    due = timers != NULL && timers->expiry <= limit;
+    set_time(due ? timers->expiry : limit);
+    if (due) {
+        sim_irq_set_pending(RTCC_IRQn);
+    }
+    CORE_EXIT_CRITICAL();
+    return due;
+}
+
+void sim_clock_fire(void) {
+    sim_irq_enter(RTCC_IRQn);
+    while (timers != NULL && timers->expiry <= now) {
+        sl_sleeptimer_timer_handle_t *handle = timers;
+        unlink_timer(handle);
+        if (handle->timeout_periodic != 0) {
+            // Reloaded from the expiry, so a periodic timer does not drift.
+            handle->expiry += handle->timeout_periodic;
+            insert_timer(handle);
+        }
+        if (handle->callback != NULL) {
+            handle->callback(handle, handle->callback_data);
+        }
+    }
+    sim_irq_exit(RTCC_IRQn);
+}
+
+bool sim_clock_step(uint64_t limit) {
+    if (!sim_clock_wait(limit)) {
+        return false;
+    }
+    sim_clock_fire();
+    return true;
+}
+
+void sim_clock_advance_to(uint64_t tick) {
+    // Each pass fires the timers due at one tick, including those the
+    // last callbacks started for the limit itself.
+    while (sim_clock_step(tick) || sim_clock_ticks() < tick) {
+        continue;
+    }
+}
+
+void sim_clock_advance_ms(uint32_t ms) {
+    sim_clock_advance_to(sim_clock_ticks() + sim_clock_ms_to_ticks(ms));
+}
+
+/**************************************************************************/
+/* Sleeptimer                                                             */
+/**************************************************************************/
+sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
+                                      uint32_t timeout,
+                                      sl_sleeptimer_timer_callback_t callback,
+                                      void *callback_data,
+                                      uint8_t priority,
+                                      uint16_t option_flags) {
+    return start_timer(handle, timeout, 0, callback, callback_data, priority, option_flags);
+}
+
+sl_status_t sl_sleeptimer_restart_timer(sl_sleeptimer_timer_handle_t *handle,
+                                        uint32_t timeout,
+                                        sl_sleeptimer_timer_callback_t callback,
+                                        void *callback_data,
+                                        uint8_t priority,
+                                        uint16_t option_flags) {
+    CORE_DECLARE_IRQ_STATE;
+    sl_status_t sc;
+
+    CORE_ENTER_CRITICAL();
+    if (handle != NULL) {
+        unlink_timer(handle);
+    }
+    sc = start_timer(handle, timeout, 0, callback, callback_data, priority, option_flags);
+    CORE_EXIT_CRITICAL();
+    return sc;
+}
+
+sl_status_t sl_sleeptimer_start_periodic_timer(sl_sleeptimer_timer_handle_t *handle,
+                                               uint32_t timeout,
+                                               sl_sleeptimer_timer_callback_t callback,
+                                               void *callback_data,
+                                               uint8_t priority,
+                                               uint16_t option_flags) {
+    if (timeout == 0) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    return start_timer(handle, timeout, timeout, callback, callback_data, priority, option_flags);
+}
+
+sl_status_t sl_sleeptimer_start_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                         uint32_t timeout_ms,
+                                         sl_sleeptimer_timer_callback_t callback,
+                                         void *callback_data,
+                                         uint8_t priority,
+                                         uint16_t option_flags) {
+    uint32_t timeout;
+    sl_status_t sc = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    return sl_sleeptimer_start_timer(handle, timeout, callback, callback_data, priority, option_flags);
+}
+
+sl_status_t sl_sleeptimer_restart_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                           uint32_t timeout_ms,
+                                           sl_sleeptimer_timer_callback_t callback,
+                                           void *callback_data,
+                                           uint8_t priority,
+                                           uint16_t option_flags) {
+    uint32_t timeout;
+    sl_status_t sc = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    return sl_sleeptimer_restart_timer(handle, timeout, callback, callback_data, priority, option_flags);
+}
+
+sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                  uint32_t timeout_ms,
+                                                  sl_sleeptimer_timer_callback_t callback,
+                                                  void *callback_data,
+                                                  uint8_t priority,
+                                                  uint16_t option_flags) {
+    uint32_t timeout;
+    sl_status_t sc = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+
+    if (sc != SL_STATUS_OK) {
+        return sc;
+    }
+    return sl_sleeptimer_start_periodic_timer(handle, timeout, callback, callback_data, priority, option_flags);
+}
+
+sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle) {
+    CORE_DECLARE_IRQ_STATE;
+    bool stopped;
+
+    if (handle == NULL) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    CORE_ENTER_CRITICAL();
+    stopped = unlink_timer(handle);
+    CORE_EXIT_CRITICAL();
+    return stopped ? SL_STATUS_OK : SL_STATUS_INVALID_STATE;
+}
+
+sl_status_t sl_sleeptimer_is_timer_running(sl_sleeptimer_timer_handle_t *handle, bool *running) {
+    CORE_DECLARE_IRQ_STATE;
+
+    if (handle == NULL || running == NULL) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    CORE_ENTER_CRITICAL();
+    *running = is_running(handle);
+    CORE_EXIT_CRITICAL();
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_sleeptimer_get_remaining_time(sl_sleeptimer_timer_handle_t *handle, uint32_t *time) {
+    CORE_DECLARE_IRQ_STATE;
+    sl_status_t sc = SL_STATUS_INVALID_STATE;
+
+    if (handle == NULL || time == NULL) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    CORE_ENTER_CRITICAL();
+    if (is_running(handle)) {
+        *time = (uint32_t)(handle->expiry - now);
+        sc = SL_STATUS_OK;
+    }
+    CORE_EXIT_CRITICAL();
+    return sc;
+}
+
+uint32_t sl_sleeptimer_get_tick_count(void) {
+    return (uint32_t)sl_sleeptimer_get_tick_count64();
+}
+
+uint64_t sl_sleeptimer_get_tick_count64(void) {
+    CORE_DECLARE_IRQ_STATE;
+    uint64_t tick;
+
+    CORE_ENTER_CRITICAL();
+    tick = now;
+    CORE_EXIT_CRITICAL();
+    return tick;
+}
+
+uint32_t sl_sleeptimer_get_timer_frequency(void) {
+    return SIM_CLOCK_FREQUENCY;
+}
+
+uint32_t sl_sleeptimer_ms_to_tick(uint16_t time_ms) {
+    return (uint32_t)sim_clock_ms_to_ticks(time_ms);
+}
+
+sl_status_t sl_sleeptimer_ms32_to_tick(uint32_t time_ms, uint32_t *tick) {
+    uint64_t ticks = sim_clock_ms_to_ticks(time_ms);
+
+    if (ticks > UINT32_MAX) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    *tick = (uint32_t)ticks;
+    return SL_STATUS_OK;
+}
+
+uint32_t sl_sleeptimer_tick_to_ms(uint32_t tick) {
+    return (uint32_t)(((uint64_t)tick * 1000) / SIM_CLOCK_FREQUENCY);
+}
+
+sl_status_t sl_sleeptimer_tick64_to_ms(uint64_t tick, uint64_t *ms) {
+    if (tick > UINT64_MAX / 1000) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    *ms = (tick * 1000) / SIM_CLOCK_FREQUENCY;
+    return SL_STATUS_OK;
+}
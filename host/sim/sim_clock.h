@@ -0,0 +1,50 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**************************************************************************/
+/* Virtual clock of the host build.                                       */
+/*                                                                        */
+/* Backs sl_sleeptimer at SIM_CLOCK_FREQUENCY and app_clock_ms(). Time    */
+/* only moves when the run loop (sim.h) or a test advances it, so every   */
+/* run of a scenario fires the same timers at the same ticks. Timer       */
+/* callbacks run as the sleeptimer interrupt: CORE_InIrqContext() is true */
+/* and RTCC_IRQn is pending in NVIC while they do.                        */
+/**************************************************************************/
+
+#define SIM_CLOCK_FREQUENCY     32768
+
+// Restart the clock at tick and forget all timers. A start tick close to
+// 2^32 exercises the 32-bit tick wrap.
+void sim_clock_reset(uint64_t tick);
+
+uint64_t sim_clock_ticks(void);
+
+// Milliseconds since the clock started, truncated to 32 bits, like
+// app_clock_ms() on target.
+uint32_t sim_clock_ms(void);
+
+uint64_t sim_clock_ms_to_ticks(uint32_t ms);
+
+// Expiry of the earliest running timer. False when none runs.
+bool sim_clock_next_expiry(uint64_t *tick);
+
+// Move to the earliest timer expiry if it is no later than limit and mark
+// the sleeptimer interrupt pending; otherwise move to limit. Returns true
+// if a timer is due. Never moves backwards.
+bool sim_clock_wait(uint64_t limit);
+
+// Run the sleeptimer interrupt: fire every timer due now.
+void sim_clock_fire(void);
+
+// sim_clock_wait(), then sim_clock_fire() if a timer is due. Returns true
+// if timers fired.
+bool sim_clock_step(uint64_t limit);
+
+// Step repeatedly until limit, firing everything due on the way.
+void sim_clock_advance_to(uint64_t tick);
+void sim_clock_advance_ms(uint32_t ms);
+
+#endif // SIM_CLOCK_H
@@ -0,0 +1,38 @@
+#include "em_core.h"
+#include "em_device.h"
+#include "sim_platform.h"
+
+// Single-threaded host build: nothing can preempt the application, so a
+// critical section only has to be tracked, not enforced.
+static uint32_t nesting = 0;
+static uint32_t irq_depth = 0;
+
+CORE_irqState_t sim_core_enter(void) {
+    return nesting++;
+}
+
+void sim_core_exit(CORE_irqState_t state) {
+    nesting = state;
+}
+
+bool CORE_IrqIsDisabled(void) {
+    return nesting > 0;
+}
+
+bool CORE_InIrqContext(void) {
+    return irq_depth > 0;
+}
+
+void sim_irq_set_pending(int irqn) {
+    NVIC->ISPR[irqn / 32] |= 1UL << (irqn % 32);
+}
+
+void sim_irq_enter(int irqn) {
+    NVIC->ISPR[irqn / 32] &= ~(1UL << (irqn % 32));
+    irq_depth++;
+}
+
+void sim_irq_exit(int irqn) {
+    (void)irqn;
+    irq_depth--;
+}
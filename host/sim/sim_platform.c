@@ -0,0 +1,156 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "em_device.h"
+#include "em_cmu.h"
+#include "em_gpio.h"
+#include "app_log.h"
+#include "sl_debug_swo.h"
+#include "sl_iostream.h"
+#include "sl_simple_led_instances.h"
+#include "sim_clock.h"
+#include "sim_platform.h"
+
+#define GPIO_PORTS      11
+
+CoreDebug_Type sim_core_debug;
+DWT_Type sim_dwt;
+ITM_Type sim_itm;
+NVIC_Type sim_nvic;
+
+static uint16_t gpio_out[GPIO_PORTS];
+static uint64_t cycle_remainder = 0;
+static bool led_on[SL_SIMPLE_LED_COUNT];
+static sl_iostream_t *default_stream = NULL;
+static bool log_enabled = true;
+
+/**************************************************************************/
+/* Core                                                                   */
+/**************************************************************************/
+uint32_t SystemCoreClockGet(void) {
+    return SIM_CORE_CLOCK_HZ;
+}
+
+void sim_platform_elapse(uint64_t ticks) {
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        return;
+    }
+    // Whole cycles only; the fraction is carried to the next call.
+    uint64_t scaled = ticks * SIM_CORE_CLOCK_HZ + cycle_remainder;
+    DWT->CYCCNT += (uint32_t)(scaled / SIM_CLOCK_FREQUENCY);
+    cycle_remainder = scaled % SIM_CLOCK_FREQUENCY;
+}
+
+void sim_platform_reset(void) {
+    memset(&sim_core_debug, 0, sizeof(sim_core_debug));
+    memset(&sim_dwt, 0, sizeof(sim_dwt));
+    memset(&sim_itm, 0, sizeof(sim_itm));
+    memset(&sim_nvic, 0, sizeof(sim_nvic));
+    memset(gpio_out, 0, sizeof(gpio_out));
+    memset(led_on, 0, sizeof(led_on));
+    cycle_remainder = 0;
+    default_stream = NULL;
+    // The sleeptimer interrupt is enabled from boot.
+    NVIC->ISER[RTCC_IRQn / 32] |= 1UL << (RTCC_IRQn % 32);
+}
+
+sl_status_t sl_debug_swo_enable_itm(uint32_t channel) {
+    ITM->TCR |= ITM_TCR_ITMENA_Msk;
+    ITM->TER |= 1UL << channel;
+    // A stimulus port reads non-zero while it can take a word.
+    ITM->PORT[channel].u32 = 1;
+    return SL_STATUS_OK;
+}
+
+void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable) {
+    (void)clock;
+    (void)enable;
+}
+
+/**************************************************************************/
+/* GPIO and LEDs                                                          */
+/**************************************************************************/
+void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin, GPIO_Mode_TypeDef mode, unsigned int out) {
+    (void)mode;
+    if (out) {
+        GPIO_PinOutSet(port, pin);
+    } else {
+        GPIO_PinOutClear(port, pin);
+    }
+}
+
+void GPIO_PinOutSet(GPIO_Port_TypeDef port, unsigned int pin) {
+    gpio_out[port] |= (uint16_t)(1U << pin);
+}
+
+void GPIO_PinOutClear(GPIO_Port_TypeDef port, unsigned int pin) {
+    gpio_out[port] &= (uint16_t)~(1U << pin);
+}
+
+unsigned int sim_gpio_get(GPIO_Port_TypeDef port, unsigned int pin) {
+    return (gpio_out[port] >> pin) & 1U;
+}
+
+const sl_led_t sl_led_led0 = { .context = &led_on[0] };
+const sl_led_t *sl_simple_led_array[] = { &sl_led_led0 };
+
+void sl_simple_led_init_instances(void) {
+    memset(led_on, 0, sizeof(led_on));
+}
+
+void sl_led_turn_on(const sl_led_t *led_handle) {
+    *(bool *)led_handle->context = true;
+}
+
+void sl_led_turn_off(const sl_led_t *led_handle) {
+    *(bool *)led_handle->context = false;
+}
+
+void sl_led_toggle(const sl_led_t *led_handle) {
+    *(bool *)led_handle->context = !*(bool *)led_handle->context;
+}
+
+sl_led_state_t sl_led_get_state(const sl_led_t *led_handle) {
+    return *(bool *)led_handle->context ? SL_LED_CURRENT_STATE_ON : SL_LED_CURRENT_STATE_OFF;
+}
+
+bool sim_led_is_on(unsigned int index) {
+    return index < SL_SIMPLE_LED_COUNT && led_on[index];
+}
+
+/**************************************************************************/
+/* Log Output                                                             */
+/**************************************************************************/
+sl_status_t sl_iostream_set_default_stream(sl_iostream_t *stream) {
+    default_stream = stream;
+    return SL_STATUS_OK;
+}
+
+void sim_log_enable(bool enable) {
+    log_enabled = enable;
+}
+
+void sim_log(const char *format, ...) {
+    char text[256];
+    va_list args;
+    int len;
+
+    if (!log_enabled) {
+        return;
+    }
+    va_start(args, format);
+    len = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (len < 0) {
+        return;
+    }
+    if ((size_t)len >= sizeof(text)) {
+        len = sizeof(text) - 1;
+    }
+    // Through the default stream, as app_log does on target.
+    if (default_stream != NULL) {
+        default_stream->write(default_stream->context, text, (size_t)len);
+    } else {
+        fwrite(text, 1, (size_t)len, stdout);
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef SIM_PLATFORM_H
+#define SIM_PLATFORM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "em_gpio.h"
+
+/**************************************************************************/
+/* Simulated MCU: interrupt context, core registers, GPIO and LEDs.       */
+/**************************************************************************/
+
+#define SIM_CORE_CLOCK_HZ   38400000UL
+
+// Interrupt entry and exit. While an interrupt runs, CORE_InIrqContext()
+// is true; entry clears its NVIC pending bit.
+void sim_irq_set_pending(int irqn);
+void sim_irq_enter(int irqn);
+void sim_irq_exit(int irqn);
+
+// Called by the virtual clock as time passes; runs DWT->CYCCNT.
+void sim_platform_elapse(uint64_t ticks);
+
+// Clear registers, pins and LEDs.
+void sim_platform_reset(void);
+
+// Level driven on a pin, 0 or 1.
+unsigned int sim_gpio_get(GPIO_Port_TypeDef port, unsigned int pin);
+
+bool sim_led_is_on(unsigned int index);
+
+#endif // SIM_PLATFORM_H
@@ -0,0 +1,181 @@
+#include <stddef.h>
+#include <string.h>
+#include "em_core.h"
+#include "sl_power_manager.h"
+#include "app_timer.h"
+#include "sl_bluetooth.h"
+#include "sl_iostream_init_usart_instances.h"
+#include "sim_clock.h"
+#include "sim_power.h"
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+#include "cmsis_os2_posix.h"
+#endif
+
+#define MAX_SUBSCRIBERS     8
+#define MODES               (SL_POWER_MANAGER_EM4 + 1)
+
+static bool vetoed[SIM_POWER_SOURCE_COUNT];
+static sl_power_manager_on_isr_exit_t isr_exit[SIM_POWER_SOURCE_COUNT];
+static bool latest_wakeup_internal = false;
+static uint64_t horizon = 0;
+static uint32_t requirements[MODES];
+static sl_power_manager_em_t mode = SL_POWER_MANAGER_EM0;
+static uint32_t sleeps = 0;
+static uint32_t entries[MODES];
+static sl_power_manager_em_transition_event_handle_t *subscribers[MAX_SUBSCRIBERS];
+static size_t subscriber_count = 0;
+
+/**************************************************************************/
+/* Test Controls                                                          */
+/**************************************************************************/
+void sim_power_reset(void) {
+    memset(vetoed, 0, sizeof(vetoed));
+    for (int source = 0; source < SIM_POWER_SOURCE_COUNT; source++) {
+        isr_exit[source] = SL_POWER_MANAGER_IGNORE;
+    }
+    isr_exit[SIM_POWER_SOURCE_BT] = 0;
+    latest_wakeup_internal = false;
+    horizon = 0;
+    memset(requirements, 0, sizeof(requirements));
+    mode = SL_POWER_MANAGER_EM0;
+    sleeps = 0;
+    memset(entries, 0, sizeof(entries));
+    subscriber_count = 0;
+}
+
+void sim_power_veto_sleep(sim_power_source_t source, bool veto) {
+    vetoed[source] = veto;
+}
+
+void sim_power_set_isr_exit(sim_power_source_t source, sl_power_manager_on_isr_exit_t answer) {
+    isr_exit[source] = answer;
+}
+
+void sim_power_set_latest_wakeup_internal(bool internal) {
+    latest_wakeup_internal = internal;
+}
+
+void sim_power_set_horizon(uint64_t tick) {
+    horizon = tick;
+}
+
+sl_power_manager_em_t sim_power_mode(void) {
+    return mode;
+}
+
+uint32_t sim_power_requirement(sl_power_manager_em_t em) {
+    return requirements[em];
+}
+
+uint32_t sim_power_sleeps(void) {
+    return sleeps;
+}
+
+uint32_t sim_power_entries(sl_power_manager_em_t em) {
+    return entries[em];
+}
+
+/**************************************************************************/
+/* Component Hooks                                                        */
+/**************************************************************************/
+bool sli_app_timer_is_ok_to_sleep(void) {
+    return !vetoed[SIM_POWER_SOURCE_APP_TIMER];
+}
+
+sl_power_manager_on_isr_exit_t sli_app_timer_sleep_on_isr_exit(void) {
+    return isr_exit[SIM_POWER_SOURCE_APP_TIMER];
+}
+
+bool sli_bt_is_ok_to_sleep(void) {
+    // The stack stays awake while it has events for the application.
+    return !vetoed[SIM_POWER_SOURCE_BT] && sl_bt_event_pending_len() == 0;
+}
+
+sl_power_manager_on_isr_exit_t sli_bt_sleep_on_isr_exit(void) {
+    if (isr_exit[SIM_POWER_SOURCE_BT] != 0) {
+        return isr_exit[SIM_POWER_SOURCE_BT];
+    }
+    return (sl_bt_event_pending_len() != 0) ? SL_POWER_MANAGER_WAKEUP : SL_POWER_MANAGER_IGNORE;
+}
+
+sl_power_manager_on_isr_exit_t sl_iostream_usart_vcom_sleep_on_isr_exit(void) {
+    return isr_exit[SIM_POWER_SOURCE_VCOM];
+}
+
+/**************************************************************************/
+/* Power Manager                                                          */
+/**************************************************************************/
+void sl_power_manager_add_em_requirement(sl_power_manager_em_t em) {
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_CRITICAL();
+    requirements[em]++;
+    CORE_EXIT_CRITICAL();
+}
+
+void sl_power_manager_remove_em_requirement(sl_power_manager_em_t em) {
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_CRITICAL();
+    if (requirements[em] > 0) {
+        requirements[em]--;
+    }
+    CORE_EXIT_CRITICAL();
+}
+
+void sl_power_manager_subscribe_em_transition_event(sl_power_manager_em_transition_event_handle_t *event_handle,
+                                                    const sl_power_manager_em_transition_event_info_t *event_info) {
+    event_handle->info = event_info;
+    if (subscriber_count < MAX_SUBSCRIBERS) {
+        subscribers[subscriber_count++] = event_handle;
+    }
+}
+
+bool sl_power_manager_is_latest_wakeup_internal(void) {
+    return latest_wakeup_internal;
+}
+
+static void transition(sl_power_manager_em_t to) {
+    sl_power_manager_em_t from = mode;
+    uint32_t event = SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM0 << (2 * to);
+
+    mode = to;
+    entries[to]++;
+    for (size_t i = 0; i < subscriber_count; i++) {
+        if (subscribers[i]->info->event_mask & event) {
+            subscribers[i]->info->on_event(from, to);
+        }
+    }
+}
+
+void sl_power_manager_sleep(void) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_CRITICAL();
+    while (sl_power_manager_is_ok_to_sleep()) {
+        sl_power_manager_em_t em = (requirements[SL_POWER_MANAGER_EM1] > 0)
+                                   ? SL_POWER_MANAGER_EM1 : SL_POWER_MANAGER_EM2;
+        bool interrupted;
+
+        transition(em);
+        sleeps++;
+        interrupted = sim_clock_wait(horizon);
+        // Woken up; the interrupt is still pending.
+        transition(SL_POWER_MANAGER_EM0);
+        if (!interrupted) {
+            break;
+        }
+        CORE_EXIT_CRITICAL();
+        sim_clock_fire();
+        CORE_ENTER_CRITICAL();
+        if (!sl_power_manager_sleep_on_isr_exit()) {
+            break;
+        }
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+        // The interrupt readied a task: the kernel switches to it rather
+        // than going back to sleep.
+        if (sim_os_thread_ready()) {
+            break;
+        }
+#endif
+    }
+    CORE_EXIT_CRITICAL();
+}
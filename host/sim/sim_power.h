@@ -0,0 +1,51 @@
+#ifndef SIM_POWER_H
+#define SIM_POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_power_manager.h"
+
+/**************************************************************************/
+/* Simulated power manager.                                               */
+/*                                                                        */
+/* sl_power_manager_sleep() follows the SDK sequence: it asks the         */
+/* generated sl_power_manager_is_ok_to_sleep(), enters the lowest allowed */
+/* mode, sleeps by moving the virtual clock to the next timer expiry,     */
+/* notifies the transition back to EM0 with the waking interrupt still    */
+/* pending, runs that interrupt, and goes back to sleep if                */
+/* sl_power_manager_sleep_on_isr_exit() says so. It returns without an    */
+/* interrupt when the clock reaches the horizon set by the run loop.      */
+/*                                                                        */
+/* The hooks of the SDK components the application does not own answer   */
+/* what the test sets here.                                               */
+/**************************************************************************/
+
+typedef enum {
+    SIM_POWER_SOURCE_APP_TIMER,
+    SIM_POWER_SOURCE_BT,            // overrides the simulated stack's own answers
+    SIM_POWER_SOURCE_VCOM,          // ISR exit only
+    SIM_POWER_SOURCE_COUNT
+} sim_power_source_t;
+
+void sim_power_reset(void);
+
+// Refuse (or stop refusing) sleep on behalf of a component.
+void sim_power_veto_sleep(sim_power_source_t source, bool veto);
+
+// Answer of a component's ISR-exit hook. SL_POWER_MANAGER_IGNORE by
+// default; 0 gives the BT source back to the simulated stack.
+void sim_power_set_isr_exit(sim_power_source_t source, sl_power_manager_on_isr_exit_t answer);
+
+void sim_power_set_latest_wakeup_internal(bool internal);
+
+// Latest time sl_power_manager_sleep() may sleep to.
+void sim_power_set_horizon(uint64_t tick);
+
+sl_power_manager_em_t sim_power_mode(void);
+uint32_t sim_power_requirement(sl_power_manager_em_t em);
+
+// Completed sleeps, and transitions into each mode.
+uint32_t sim_power_sleeps(void);
+uint32_t sim_power_entries(sl_power_manager_em_t em);
+
+#endif // SIM_POWER_H
@@ -0,0 +1,82 @@
+#include <stddef.h>
+#include "sl_sensor_rht.h"
+#include "sl_sensor_light.h"
+#include "sim_sensors.h"
+
+static uint32_t humidity = 45000;
+static int32_t temperature = 22500;
+static float light_lux = 120.0f;
+static float light_uvi = 0.0f;
+static sl_status_t rht_result = SL_STATUS_OK;
+static sl_status_t light_result = SL_STATUS_OK;
+static sim_sensors_read_hook_t read_hook = NULL;
+
+void sim_sensors_reset(void) {
+    humidity = 45000;
+    temperature = 22500;
+    light_lux = 120.0f;
+    light_uvi = 0.0f;
+    rht_result = SL_STATUS_OK;
+    light_result = SL_STATUS_OK;
+    read_hook = NULL;
+}
+
+void sim_sensors_set_rht(uint32_t rh, int32_t t) {
+    humidity = rh;
+    temperature = t;
+}
+
+void sim_sensors_get_rht(uint32_t *rh, int32_t *t) {
+    *rh = humidity;
+    *t = temperature;
+}
+
+void sim_sensors_set_light(float lux, float uvi) {
+    light_lux = lux;
+    light_uvi = uvi;
+}
+
+void sim_sensors_set_status(sl_status_t rht_status, sl_status_t light_status) {
+    rht_result = rht_status;
+    light_result = light_status;
+}
+
+void sim_sensors_set_read_hook(sim_sensors_read_hook_t hook) {
+    read_hook = hook;
+}
+
+sl_status_t sl_sensor_rht_init(void) {
+    return SL_STATUS_OK;
+}
+
+void sl_sensor_rht_deinit(void) {
+}
+
+sl_status_t sl_sensor_rht_get(uint32_t *rh, int32_t *t) {
+    if (read_hook != NULL) {
+        read_hook();
+    }
+    if (rht_result == SL_STATUS_OK) {
+        *rh = humidity;
+        *t = temperature;
+    }
+    return rht_result;
+}
+
+sl_status_t sl_sensor_light_init(void) {
+    return SL_STATUS_OK;
+}
+
+void sl_sensor_light_deinit(void) {
+}
+
+sl_status_t sl_sensor_light_get(float *lux, float *uvi) {
+    if (read_hook != NULL) {
+        read_hook();
+    }
+    if (light_result == SL_STATUS_OK) {
+        *lux = light_lux;
+        *uvi = light_uvi;
+    }
+    return light_result;
+}
@@ -0,0 +1,30 @@
+#ifndef SIM_SENSORS_H
+#define SIM_SENSORS_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+/**************************************************************************/
+/* Simulated Thunderboard sensors.                                        */
+/*                                                                        */
+/* The blocking sl_sensor_* drivers and the simulated Si7021 behind       */
+/* rht_async_bus report what the test sets here.                          */
+/**************************************************************************/
+
+void sim_sensors_reset(void);
+
+// Relative humidity in m%RH and temperature in m°C, as the si70xx driver.
+void sim_sensors_set_rht(uint32_t rh, int32_t temperature);
+void sim_sensors_get_rht(uint32_t *rh, int32_t *temperature);
+
+void sim_sensors_set_light(float lux, float uvi);
+
+// Result of the blocking driver reads; SL_STATUS_OK by default.
+void sim_sensors_set_status(sl_status_t rht_status, sl_status_t light_status);
+
+// Called by the blocking driver reads where the I2C transfer would run,
+// from the reading task. NULL (the default) returns at once.
+typedef void (*sim_sensors_read_hook_t)(void);
+void sim_sensors_set_read_hook(sim_sensors_read_hook_t hook);
+
+#endif // SIM_SENSORS_H
@@ -0,0 +1,10 @@
+// history_log_config.h with the log enabled, for test_history_log.
+#ifndef TEST_HISTORY_LOG_CONFIG_H
+#define TEST_HISTORY_LOG_CONFIG_H
+
+#include "../../../../config/history_log_config.h"
+
+#undef HISTORY_LOG_ENABLE
+#define HISTORY_LOG_ENABLE                 1
+
+#endif // TEST_HISTORY_LOG_CONFIG_H
@@ -0,0 +1,51 @@
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**************************************************************************/
+/* Minimal test harness for the host build.                               */
+/*                                                                        */
+/* A failed check prints where and what, and the test keeps going so one  */
+/* run reports every failure. main() returns test_result().               */
+/**************************************************************************/
+
+static int test_failures;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            test_failures++;                                                \
+        }                                                                   \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                          \
+    do {                                                                    \
+        long long test_a_ = (long long)(actual);                            \
+        long long test_e_ = (long long)(expected);                          \
+        if (test_a_ != test_e_) {                                           \
+            printf("%s:%d: %s == %lld, expected %s == %lld\n",              \
+                   __FILE__, __LINE__, #actual, test_a_, #expected, test_e_); \
+            test_failures++;                                                \
+        }                                                                   \
+    } while (0)
+
+#define RUN_TEST(fn)                    \
+    do {                                \
+        printf("-- %s\n", #fn);         \
+        fn();                           \
+    } while (0)
+
+static inline int test_result(void) {
+    printf(test_failures ? "FAILED: %d check(s)\n" : "OK\n", test_failures);
+    return test_failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// Little-endian field of a recorded packet.
+static inline int test_le16(const uint8_t *data) {
+    return (int16_t)(data[0] | (data[1] << 8));
+}
+
+#endif // TEST_H
@@ -0,0 +1,103 @@
+#include <stdint.h>
+#include <string.h>
+#include "gatt_db.h"
+#include "sim.h"
+#include "test.h"
+
+/**************************************************************************/
+/* Boot and one connection through the whole firmware: advertising,      */
+/* notified sensor values, the measurement interval characteristic and    */
+/* advertising again after the link closes.                               */
+/**************************************************************************/
+
+#define CONNECTION  1
+
+static void test_advertises_after_boot(void) {
+    uint8_t value[16];
+    size_t len = 0;
+
+    sim_boot();
+    CHECK(sim_bt_is_advertising());
+
+    // The Device Information service filled in its values on boot.
+    CHECK_EQ(sl_bt_gatt_server_read_attribute_value(gattdb_model_number_string, 0, sizeof(value), &len, value),
+             SL_STATUS_OK);
+    CHECK(len == 8 && memcmp(value, "BRD4166A", 8) == 0);
+}
+
+static void test_notifies_subscribed_temperature(void) {
+    sim_sensors_set_rht(40000, 22500);
+    sim_bt_open(CONNECTION);
+    sim_bt_subscribe(CONNECTION, gattdb_temperature, gatt_notification);
+    CHECK(!sim_bt_is_advertising());
+
+    sim_bt_clear_sent();
+    sim_run_ms(2500);
+
+    const sim_bt_packet_t *packet = sim_bt_last(SIM_BT_NOTIFICATION, CONNECTION, gattdb_temperature);
+    CHECK(packet != NULL);
+    if (packet != NULL) {
+        CHECK_EQ(packet->len, 2);
+        CHECK_EQ(test_le16(packet->data), 2250);
+    }
+    // Humidity is not subscribed.
+    CHECK_EQ(sim_bt_count(SIM_BT_NOTIFICATION, CONNECTION, gattdb_humidity_0), 0);
+}
+
+static void test_measurement_interval(void) {
+    const sim_bt_packet_t *packet;
+    uint8_t interval[2] = { 5, 0 };
+
+    sim_bt_read(CONNECTION, gattdb_measurement_interval);
+    sim_run_idle();
+    packet = sim_bt_last(SIM_BT_READ_RESPONSE, CONNECTION, gattdb_measurement_interval);
+    CHECK(packet != NULL);
+    if (packet != NULL) {
+        CHECK_EQ(packet->len, 2);
+        CHECK_EQ(test_le16(packet->data), 1);
+    }
+
+    sim_bt_write(CONNECTION, gattdb_measurement_interval, sl_bt_gatt_write_request, interval, sizeof(interval));
+    sim_run_idle();
+    packet = sim_bt_last(SIM_BT_WRITE_RESPONSE, CONNECTION, gattdb_measurement_interval);
+    CHECK(packet != NULL);
+    if (packet != NULL) {
+        CHECK_EQ(packet->att_errcode, 0);
+    }
+
+    // A short write is rejected.
+    sim_bt_write(CONNECTION, gattdb_measurement_interval, sl_bt_gatt_write_request, interval, 1);
+    sim_run_idle();
+    packet = sim_bt_last(SIM_BT_WRITE_RESPONSE, CONNECTION, gattdb_measurement_interval);
+    CHECK(packet != NULL);
+    if (packet != NULL) {
+        CHECK_EQ(packet->att_errcode, sl_bt_att_errcode_invalid_att_length);
+    }
+
+    sim_bt_read(CONNECTION, gattdb_measurement_interval);
+    sim_run_idle();
+    packet = sim_bt_last(SIM_BT_READ_RESPONSE, CONNECTION, gattdb_measurement_interval);
+    CHECK(packet != NULL);
+    if (packet != NULL) {
+        CHECK_EQ(test_le16(packet->data), 5);
+    }
+}
+
+static void test_advertises_after_close(void) {
+    sim_bt_close(CONNECTION, 0x13);
+    sim_run_idle();
+    CHECK(sim_bt_is_advertising());
+
+    // Nothing is notified without a connection.
+    sim_bt_clear_sent();
+    sim_run_ms(3000);
+    CHECK_EQ(sim_bt_sent_count(), 0);
+}
+
+int main(void) {
+    RUN_TEST(test_advertises_after_boot);
+    RUN_TEST(test_notifies_subscribed_temperature);
+    RUN_TEST(test_measurement_interval);
+    RUN_TEST(test_advertises_after_close);
+    return test_result();
+}
@@ -0,0 +1,164 @@
+#include <stdint.h>
+#include <stdio.h>
+#include "gatt_db.h"
+#include "history_flash.h"
+#include "sensor_scheduler.h"
+#include "sim.h"
+#include "test.h"
+
+/**************************************************************************/
+/* The sample history log on the file-backed flash, built with            */
+/* HISTORY_LOG_ENABLE (tests/config/history_log): pages programmed as     */
+/* samples come in, the sector ahead erased without stalling the log, a   */
+/* full download over the History characteristic, one started while that */
+/* erase runs, and the image still holding the log after a power cycle of */
+/* the part.                                                              */
+/**************************************************************************/
+
+#define IMAGE_PATH      "test_history_log.bin"
+#define IMAGE_SIZE      (16 * HISTORY_FLASH_SECTOR_SIZE)
+#define CONNECTION      1
+
+#define PAGE_MAGIC      0x4C48
+#define RECORD_SIZE     5
+#define STREAM_HEADER   10
+
+static uint32_t get_u32(const uint8_t *data) {
+    return data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static void test_boot_keeps_fresh_image(void) {
+    remove(IMAGE_PATH);
+    CHECK_EQ(sim_flash_open(IMAGE_PATH, IMAGE_SIZE), SL_STATUS_OK);
+    sim_boot();
+    // A blank part is already erased: nothing to erase at boot.
+    CHECK_EQ(sim_flash_erases(), 0);
+    CHECK(sim_flash_is_powered_down());
+}
+
+static void test_logs_without_stalling(void) {
+    sim_sensors_set_rht(40000, 22500);
+    sim_run_ms(40000);
+
+    // Three samples a second fill a page every 16 s.
+    CHECK_EQ(sim_flash_programs(), 2);
+    // Entering sector 0 erased sector 1 ahead of the log.
+    CHECK_EQ(sim_flash_erases(), 1);
+    CHECK_EQ(sim_flash_stalls(), 0);
+    // The erase poll powered the part down once the erase was over.
+    CHECK(sim_flash_is_powered_down());
+}
+
+static void request_download(void) {
+    uint8_t from_seq[4] = { 0, 0, 0, 0 };
+
+    sim_bt_clear_sent();
+    sim_bt_write(CONNECTION, gattdb_history, sl_bt_gatt_write_request, from_seq, sizeof(from_seq));
+}
+
+// The final, empty notification of a download, or NULL.
+static const sim_bt_packet_t *download_end(void) {
+    for (uint32_t i = 0; i < sim_bt_sent_count(); i++) {
+        const sim_bt_packet_t *packet = sim_bt_sent(i);
+        if (packet->type == SIM_BT_NOTIFICATION && packet->characteristic == gattdb_history
+            && packet->len == STREAM_HEADER) {
+            return packet;
+        }
+    }
+    return NULL;
+}
+
+static void test_downloads_everything(void) {
+    uint32_t expected_seq = 0;
+    uint32_t temperatures = 0;
+    bool done = false;
+
+    sim_bt_open(CONNECTION);
+    sim_bt_mtu(CONNECTION, 247);
+    sim_bt_subscribe(CONNECTION, gattdb_history, gatt_notification);
+    sim_run_idle();
+    request_download();
+    sim_run_idle();
+
+    const sim_bt_packet_t *response = sim_bt_last(SIM_BT_WRITE_RESPONSE, CONNECTION, gattdb_history);
+    CHECK(response != NULL && response->att_errcode == 0);
+
+    for (uint32_t i = 0; i < sim_bt_sent_count() && !done; i++) {
+        const sim_bt_packet_t *packet = sim_bt_sent(i);
+        if (packet->type != SIM_BT_NOTIFICATION || packet->characteristic != gattdb_history) {
+            continue;
+        }
+        CHECK_EQ(get_u32(&packet->data[0]), expected_seq);
+        CHECK_EQ(test_le16(&packet->data[4]), 0);       // first boot
+        uint32_t records = (packet->len - STREAM_HEADER) / RECORD_SIZE;
+        for (uint32_t r = 0; r < records; r++) {
+            const uint8_t *record = &packet->data[STREAM_HEADER + r * RECORD_SIZE];
+            if (record[0] == SENSOR_ID_TEMPERATURE) {
+                CHECK_EQ(test_le16(&record[3]), 2250);
+                temperatures++;
+            }
+        }
+        expected_seq += records;
+        done = (records == 0);
+    }
+    CHECK(done);
+    CHECK(expected_seq >= 3 * 39);
+    CHECK(temperatures >= 39);
+}
+
+static void test_downloads_during_erase(void) {
+    uint32_t erases = sim_flash_erases();
+    const sim_bt_packet_t *end;
+
+    // Page 16 opens sector 1, and committing it starts erasing sector 2.
+    sim_run_ms(200000);
+    while (sim_flash_erases() == erases) {
+        sim_run_ms(10);
+    }
+    CHECK(history_flash_busy());
+
+    request_download();
+    sim_run_idle();
+    // The stream waits the erase out on its retry timer.
+    CHECK(download_end() == NULL);
+    sim_run_ms(SIM_FLASH_SECTOR_ERASE_MS + 100);
+
+    end = download_end();
+    CHECK(end != NULL);
+    if (end != NULL) {
+        CHECK(get_u32(&end->data[0]) >= 3 * 250);
+    }
+    CHECK_EQ(sim_flash_stalls(), 0);
+}
+
+static void test_image_survives_power_cycle(void) {
+    uint8_t header[18];
+    uint8_t erased[16];
+
+    sim_flash_close();
+    CHECK_EQ(history_flash_init(), SL_STATUS_NOT_FOUND);
+
+    CHECK_EQ(sim_flash_open(IMAGE_PATH, IMAGE_SIZE), SL_STATUS_OK);
+    CHECK_EQ(history_flash_init(), SL_STATUS_OK);
+    for (uint32_t page = 0; page < 2; page++) {
+        CHECK_EQ(history_flash_read(page * HISTORY_FLASH_PAGE_SIZE, header, sizeof(header)), SL_STATUS_OK);
+        CHECK_EQ(test_le16(&header[0]) & 0xFFFF, PAGE_MAGIC);
+        CHECK_EQ(get_u32(&header[4]), page);            // page_seq
+    }
+    // Sector 2 is the one kept erased ahead of the log.
+    CHECK_EQ(history_flash_read(2 * HISTORY_FLASH_SECTOR_SIZE, erased, sizeof(erased)), SL_STATUS_OK);
+    for (size_t i = 0; i < sizeof(erased); i++) {
+        CHECK_EQ(erased[i], 0xFF);
+    }
+    sim_flash_close();
+    remove(IMAGE_PATH);
+}
+
+int main(void) {
+    RUN_TEST(test_boot_keeps_fresh_image);
+    RUN_TEST(test_logs_without_stalling);
+    RUN_TEST(test_downloads_everything);
+    RUN_TEST(test_downloads_during_erase);
+    RUN_TEST(test_image_survives_power_cycle);
+    return test_result();
+}
@@ -0,0 +1,108 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "cmsis_os2.h"
+#include "gatt_db.h"
+#include "sim.h"
+#include "sim_kernel.h"
+#include "test.h"
+
+/**************************************************************************/
+/* Kernel build on the POSIX port: the Bluetooth event task, the sensor   */
+/* task and the report task as threads. A GATT read arriving while the    */
+/* sensor task is inside a slow I2C transfer must be answered before the  */
+/* transfer ends, and each task's wake-up latency is measured on the      */
+/* host scheduler.                                                        */
+/**************************************************************************/
+
+#define CONNECTION          1
+#define SERVE_TIMEOUT_NS    1000000000ULL
+#define POLL_NS             50000L
+
+static bool hook_ran = false;
+static bool served = false;
+static uint64_t served_ns = 0;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Runs in the sensor task, in place of the I2C transfer: raise a read
+// request and hold the bus until the event task has dispatched it.
+static void slow_transfer(void) {
+    const struct timespec poll = { .tv_sec = 0, .tv_nsec = POLL_NS };
+    uint32_t before = sim_kernel_events();
+    uint64_t start = now_ns();
+
+    sim_sensors_set_read_hook(NULL);
+    hook_ran = true;
+    sim_bt_read(CONNECTION, gattdb_measurement_interval);
+    while (sim_kernel_events() == before && now_ns() - start < SERVE_TIMEOUT_NS) {
+        nanosleep(&poll, NULL);
+    }
+    served = (sim_kernel_events() != before);
+    served_ns = now_ns() - start;
+}
+
+static void test_tasks_start(void) {
+    sim_os_latency_t latency;
+
+    sim_boot();
+    CHECK_EQ(osKernelGetState(), osKernelRunning);
+    CHECK(sim_os_latency(SIM_KERNEL_EVENT_TASK_NAME, &latency));
+    CHECK(sim_os_latency("sensor", &latency));
+    CHECK(sim_os_latency("report", &latency));
+    // The boot event went through the event task.
+    CHECK(sim_kernel_events() >= 1);
+    CHECK(sim_bt_is_advertising());
+}
+
+static void test_read_served_during_sensor_read(void) {
+    const sim_bt_packet_t *packet;
+
+    sim_bt_open(CONNECTION);
+    sim_bt_subscribe(CONNECTION, gattdb_temperature, gatt_notification);
+    sim_run_idle();
+    sim_bt_clear_sent();
+
+    sim_sensors_set_read_hook(slow_transfer);
+    sim_run_ms(1500);
+
+    CHECK(hook_ran);
+    CHECK(served);
+    printf("Read served %.1f us into the sensor transfer.\n", served_ns / 1000.0);
+    packet = sim_bt_last(SIM_BT_READ_RESPONSE, CONNECTION, gattdb_measurement_interval);
+    CHECK(packet != NULL);
+    if (packet != NULL) {
+        CHECK_EQ(test_le16(packet->data), 1);
+    }
+    // The transfer then completed and its result was notified.
+    CHECK(sim_bt_count(SIM_BT_NOTIFICATION, CONNECTION, gattdb_temperature) > 0);
+}
+
+static void test_measures_wakeup_latency(void) {
+    sim_os_latency_t event_latency = { 0 };
+    sim_os_latency_t sensor_latency = { 0 };
+
+    sim_os_latency_reset();
+    sim_run_ms(10000);
+
+    CHECK(sim_os_latency(SIM_KERNEL_EVENT_TASK_NAME, &event_latency));
+    CHECK(sim_os_latency("sensor", &sensor_latency));
+    // One sensor request per second, each answered through the event task.
+    CHECK(sensor_latency.wakeups >= 10);
+    CHECK(event_latency.wakeups >= sensor_latency.wakeups);
+    sim_os_latency_print();
+}
+
+int main(void) {
+    RUN_TEST(test_tasks_start);
+    RUN_TEST(test_read_served_during_sensor_read);
+    RUN_TEST(test_measures_wakeup_latency);
+    return test_result();
+}
@@ -0,0 +1,150 @@
+#include <stdint.h>
+#include "rht_async.h"
+#include "rht_async_config.h"
+#include "sim.h"
+#include "test.h"
+
+/**************************************************************************/
+/* rht_async against the simulated Si7021: conversion NACKs and their     */
+/* retries, scripted bus faults and the posted result.                    */
+/**************************************************************************/
+
+#define DONE_SIGNAL     0x80
+
+// One code step of the Si7021 is 1.9 m%RH and 2.7 m°C.
+#define RH_STEP         2
+#define TEMP_STEP       3
+
+static void setup(uint32_t conversion_ms) {
+    sim_init();
+    rht_async_init(DONE_SIGNAL);
+    sim_rht_bus_set_conversion_ms(conversion_ms);
+}
+
+// Run until the acquisition is over, return the signals it posted.
+static uint32_t run_acquisition(rht_async_result_t *result) {
+    sl_bt_msg_t evt;
+    uint32_t signals = 0;
+
+    sim_clock_advance_ms(200);
+    while (sl_bt_pop_event(&evt) == SL_STATUS_OK) {
+        if (SL_BT_MSG_ID(evt.header) == sl_bt_evt_system_external_signal_id) {
+            signals |= evt.data.evt_system_external_signal.extsignals;
+        }
+    }
+    rht_async_get_result(result);
+    return signals;
+}
+
+static void check_near(int32_t actual, int32_t expected, int32_t step) {
+    CHECK(actual >= expected && actual <= expected + step);
+}
+
+static void test_reads_within_nominal_conversion(void) {
+    rht_async_result_t result;
+
+    setup(RHT_ASYNC_CONVERSION_TIME_MS - 3);
+    sim_sensors_set_rht(45000, 22500);
+    CHECK_EQ(rht_async_start(), SL_STATUS_OK);
+    CHECK(rht_async_is_busy());
+    CHECK_EQ(rht_async_start(), SL_STATUS_BUSY);
+
+    CHECK_EQ(run_acquisition(&result), DONE_SIGNAL);
+    CHECK(!rht_async_is_busy());
+    CHECK_EQ(result.status, SL_STATUS_OK);
+    check_near((int32_t)result.rh, 45000, RH_STEP);
+    check_near(result.temperature, 22500, TEMP_STEP);
+    CHECK_EQ(sim_rht_bus_nacks(), 0);
+    // Measure, read RH, read temperature.
+    CHECK_EQ(sim_rht_bus_transfers(), 3);
+}
+
+static void test_retries_while_converting(void) {
+    rht_async_result_t result;
+    uint32_t conversion_ms = RHT_ASYNC_CONVERSION_TIME_MS + 2 * RHT_ASYNC_RETRY_DELAY_MS;
+
+    setup(conversion_ms);
+    sim_sensors_set_rht(61000, -5250);
+    CHECK_EQ(rht_async_start(), SL_STATUS_OK);
+
+    CHECK_EQ(run_acquisition(&result), DONE_SIGNAL);
+    CHECK_EQ(result.status, SL_STATUS_OK);
+    check_near((int32_t)result.rh, 61000, RH_STEP);
+    check_near(result.temperature, -5250, TEMP_STEP);
+    // The sensor NACKed the first two reads of the result.
+    CHECK_EQ(sim_rht_bus_nacks(), 2);
+    CHECK_EQ(sim_rht_bus_transfers(), 5);
+    CHECK(result.done_tick - result.start_tick >= sim_clock_ms_to_ticks(conversion_ms));
+}
+
+static void test_gives_up_after_max_retries(void) {
+    rht_async_result_t result;
+
+    setup(RHT_ASYNC_CONVERSION_TIME_MS + (RHT_ASYNC_MAX_RETRIES + 2) * RHT_ASYNC_RETRY_DELAY_MS);
+    CHECK_EQ(rht_async_start(), SL_STATUS_OK);
+
+    CHECK_EQ(run_acquisition(&result), DONE_SIGNAL);
+    CHECK_EQ(result.status, SL_STATUS_NOT_READY);
+    CHECK_EQ(sim_rht_bus_nacks(), RHT_ASYNC_MAX_RETRIES + 1);
+    CHECK(!rht_async_is_busy());
+
+    // The conversion has finished by now; the next acquisition succeeds.
+    sim_rht_bus_set_conversion_ms(RHT_ASYNC_CONVERSION_TIME_MS - 3);
+    CHECK_EQ(rht_async_start(), SL_STATUS_OK);
+    CHECK_EQ(run_acquisition(&result), DONE_SIGNAL);
+    CHECK_EQ(result.status, SL_STATUS_OK);
+}
+
+static void test_reports_bus_errors(void) {
+    rht_async_result_t result;
+
+    // Error on the measure command: no retry.
+    setup(RHT_ASYNC_CONVERSION_TIME_MS - 3);
+    sim_rht_bus_fail_next(1, SL_STATUS_IO);
+    CHECK_EQ(rht_async_start(), SL_STATUS_OK);
+    CHECK_EQ(run_acquisition(&result), DONE_SIGNAL);
+    CHECK_EQ(result.status, SL_STATUS_IO);
+    CHECK_EQ(sim_rht_bus_transfers(), 1);
+
+    // A NACKed measure command is not retried either.
+    setup(RHT_ASYNC_CONVERSION_TIME_MS - 3);
+    sim_rht_bus_fail_next(1, SL_STATUS_NOT_READY);
+    CHECK_EQ(rht_async_start(), SL_STATUS_OK);
+    CHECK_EQ(run_acquisition(&result), DONE_SIGNAL);
+    CHECK_EQ(result.status, SL_STATUS_NOT_READY);
+    CHECK_EQ(sim_rht_bus_transfers(), 1);
+
+    // Error on the temperature read, after the RH result came back.
+    setup(RHT_ASYNC_CONVERSION_TIME_MS - 3);
+    CHECK_EQ(rht_async_start(), SL_STATUS_OK);
+    // The RH read starts once the measure command completed and the
+    // conversion timer ran out.
+    sim_clock_advance_to(SIM_RHT_BUS_TRANSFER_TICKS + sim_clock_ms_to_ticks(RHT_ASYNC_CONVERSION_TIME_MS));
+    CHECK_EQ(sim_rht_bus_transfers(), 2);
+    sim_rht_bus_fail_next(1, SL_STATUS_IO);
+    CHECK_EQ(run_acquisition(&result), DONE_SIGNAL);
+    CHECK_EQ(result.status, SL_STATUS_IO);
+    CHECK_EQ(result.rh, 0);
+    CHECK_EQ(sim_rht_bus_transfers(), 3);
+}
+
+static void test_clamps_humidity(void) {
+    rht_async_result_t result;
+
+    setup(RHT_ASYNC_CONVERSION_TIME_MS - 3);
+    // Codes above 100 %RH are possible; the driver clamps them.
+    sim_sensors_set_rht(118000, 22500);
+    CHECK_EQ(rht_async_start(), SL_STATUS_OK);
+    run_acquisition(&result);
+    CHECK_EQ(result.status, SL_STATUS_OK);
+    CHECK_EQ(result.rh, 100000);
+}
+
+int main(void) {
+    RUN_TEST(test_reads_within_nominal_conversion);
+    RUN_TEST(test_retries_while_converting);
+    RUN_TEST(test_gives_up_after_max_retries);
+    RUN_TEST(test_reports_bus_errors);
+    RUN_TEST(test_clamps_humidity);
+    return test_result();
+}
@@ -0,0 +1,187 @@
+#include <stdint.h>
+#include <string.h>
+#include "app_scheduler.h"
+#include "sl_sleeptimer.h"
+#include "sleep_veto.h"
+#include "sleep_veto_config.h"
+#include "sim.h"
+#include "test.h"
+
+/**************************************************************************/
+/* Sleep veto attribution through the generated power manager handler:   */
+/* each source that refuses sleep or forces a wake-up is counted and      */
+/* recorded at the right tick, and an interrupt nobody claims is reported */
+/* as unclaimed.                                                          */
+/**************************************************************************/
+
+#define JOB_PRIORITY_TEST   1
+
+static sleep_veto_counters_t before;
+static sleep_veto_counters_t after;
+static sl_sleeptimer_timer_handle_t test_timer;
+static uint64_t fired_tick;
+static app_job_t test_job;
+static uint32_t job_runs;
+static uint32_t job_reposts;
+
+static void snapshot(sleep_veto_counters_t *counters) {
+    sleep_veto_get_counters(counters);
+}
+
+static bool last_record(sleep_veto_record_t *record) {
+    sleep_veto_record_t records[SLEEP_VETO_RECORDS];
+    size_t count = sleep_veto_get_records(records, SLEEP_VETO_RECORDS);
+
+    if (count == 0) {
+        return false;
+    }
+    *record = records[count - 1];
+    return true;
+}
+
+static void test_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    fired_tick = sim_clock_ticks();
+}
+
+static void test_job_handler(void) {
+    job_runs++;
+    if (job_reposts > 0) {
+        job_reposts--;
+        app_scheduler_post(&test_job);
+    }
+}
+
+static void test_idle_sleeps(void) {
+    sim_boot();
+    app_scheduler_add(&test_job, "test", JOB_PRIORITY_TEST, test_job_handler);
+
+    snapshot(&before);
+    sim_run_ms(10000);
+    snapshot(&after);
+    CHECK(after.sleep_checks > before.sleep_checks);
+    CHECK(sim_power_sleeps() > 0);
+    for (int source = 0; source < SLEEP_VETO_SOURCE_COUNT; source++) {
+        CHECK_EQ(after.denied[source], before.denied[source]);
+    }
+}
+
+static void test_attributes_denials(void) {
+    sleep_veto_record_t record;
+    static const struct {
+        sim_power_source_t sim;
+        sleep_veto_source_t source;
+    } vetoes[] = {
+        { SIM_POWER_SOURCE_APP_TIMER, SLEEP_VETO_SOURCE_APP_TIMER },
+        { SIM_POWER_SOURCE_BT, SLEEP_VETO_SOURCE_BT },
+    };
+
+    for (size_t i = 0; i < sizeof(vetoes) / sizeof(vetoes[0]); i++) {
+        uint32_t sleeps = sim_power_sleeps();
+        uint64_t start = sim_clock_ticks();
+
+        snapshot(&before);
+        sim_power_veto_sleep(vetoes[i].sim, true);
+        sim_run_ms(1000);
+        sim_power_veto_sleep(vetoes[i].sim, false);
+        snapshot(&after);
+
+        CHECK_EQ(sim_power_sleeps(), sleeps);
+        CHECK(after.denied[vetoes[i].source] > before.denied[vetoes[i].source]);
+        CHECK_EQ(after.denied[vetoes[i].source] - before.denied[vetoes[i].source],
+                 after.sleep_checks - before.sleep_checks);
+        CHECK(last_record(&record));
+        CHECK_EQ(record.source, vetoes[i].source);
+        CHECK_EQ(record.kind, SLEEP_VETO_DENIED);
+        CHECK(record.tick >= (uint32_t)start && record.tick <= (uint32_t)sim_clock_ticks());
+    }
+}
+
+static void test_attributes_scheduler_denial(void) {
+    sleep_veto_record_t record;
+
+    // A job that posts itself again is still pending when the loop asks
+    // to sleep.
+    snapshot(&before);
+    job_runs = 0;
+    job_reposts = 2;
+    app_scheduler_post(&test_job);
+    sim_run_idle();
+    snapshot(&after);
+    CHECK_EQ(job_runs, 3);
+    CHECK_EQ(after.denied[SLEEP_VETO_SOURCE_SCHEDULER] - before.denied[SLEEP_VETO_SOURCE_SCHEDULER], 2);
+    CHECK(last_record(&record));
+    CHECK_EQ(record.source, SLEEP_VETO_SOURCE_SCHEDULER);
+    CHECK_EQ(record.kind, SLEEP_VETO_DENIED);
+}
+
+static void test_attributes_scheduler_wakeup(void) {
+    sleep_veto_record_t record;
+    uint64_t due = sim_clock_ticks() + sim_clock_ms_to_ticks(100);
+
+    snapshot(&before);
+    job_runs = 0;
+    app_scheduler_post_in(&test_job, 100);
+    sim_run_ms(200);
+    snapshot(&after);
+    CHECK_EQ(job_runs, 1);
+    CHECK_EQ(after.wakeups[SLEEP_VETO_SOURCE_SCHEDULER] - before.wakeups[SLEEP_VETO_SOURCE_SCHEDULER], 1);
+    CHECK(last_record(&record));
+    CHECK_EQ(record.source, SLEEP_VETO_SOURCE_SCHEDULER);
+    CHECK_EQ(record.kind, SLEEP_VETO_WAKEUP);
+    CHECK(record.tick >= (uint32_t)due - 1 && record.tick <= (uint32_t)due + 1);
+}
+
+static void test_attributes_vcom_wakeup(void) {
+    sleep_veto_record_t record;
+
+    snapshot(&before);
+    sim_power_set_isr_exit(SIM_POWER_SOURCE_VCOM, SL_POWER_MANAGER_WAKEUP);
+    sl_sleeptimer_start_timer_ms(&test_timer, 50, test_timer_callback, NULL, 0, 0);
+    sim_run_ms(100);
+    sim_power_set_isr_exit(SIM_POWER_SOURCE_VCOM, SL_POWER_MANAGER_IGNORE);
+    snapshot(&after);
+    CHECK_EQ(after.wakeups[SLEEP_VETO_SOURCE_VCOM] - before.wakeups[SLEEP_VETO_SOURCE_VCOM], 1);
+    CHECK_EQ(after.unclaimed, before.unclaimed);
+    CHECK(last_record(&record));
+    CHECK_EQ(record.source, SLEEP_VETO_SOURCE_VCOM);
+    CHECK_EQ(record.kind, SLEEP_VETO_WAKEUP);
+    CHECK_EQ(record.tick, (uint32_t)fired_tick);
+}
+
+static void test_reports_unclaimed_wakeup(void) {
+    sleep_veto_record_t record;
+
+    // A timer nobody answers for wakes the MCU without a claim.
+    snapshot(&before);
+    sl_sleeptimer_start_timer_ms(&test_timer, 50, test_timer_callback, NULL, 0, 0);
+    sim_run_ms(100);
+    snapshot(&after);
+    CHECK_EQ(after.isr_exits - before.isr_exits, 1);
+    CHECK_EQ(after.unclaimed - before.unclaimed, 1);
+    CHECK(last_record(&record));
+    CHECK_EQ(record.source, SLEEP_VETO_SOURCE_NONE);
+    CHECK_EQ(record.kind, SLEEP_VETO_UNCLAIMED);
+    CHECK_EQ(record.tick, (uint32_t)fired_tick);
+
+    // The power manager's own wake-ups go back to sleep unclaimed.
+    snapshot(&before);
+    sim_power_set_latest_wakeup_internal(true);
+    sl_sleeptimer_start_timer_ms(&test_timer, 50, test_timer_callback, NULL, 0, 0);
+    sim_run_ms(100);
+    sim_power_set_latest_wakeup_internal(false);
+    snapshot(&after);
+    CHECK_EQ(after.isr_exits - before.isr_exits, 1);
+    CHECK_EQ(after.unclaimed, before.unclaimed);
+}
+
+int main(void) {
+    RUN_TEST(test_idle_sleeps);
+    RUN_TEST(test_attributes_denials);
+    RUN_TEST(test_attributes_scheduler_denial);
+    RUN_TEST(test_attributes_scheduler_wakeup);
+    RUN_TEST(test_attributes_vcom_wakeup);
+    RUN_TEST(test_reports_unclaimed_wakeup);
+    return test_result();
+}
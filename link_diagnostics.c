@@ -0,0 +1,33 @@
+#include "sl_bluetooth.h"
+#include "gatt_db.h"
+#include "connection_table.h"
+#include "notify_queue.h"
+#include "link_diagnostics.h"
+
+size_t link_diagnostics_encode(uint8_t connection, uint8_t *buf) {
+    const connection_entry_t *entry = connection_table_find(connection);
+    if (entry == NULL) {
+        return 0;
+    }
+    buf[0] = entry->phy;
+    buf[1] = entry->interval & 0xFF;
+    buf[2] = (entry->interval >> 8) & 0xFF;
+    buf[3] = entry->latency & 0xFF;
+    buf[4] = (entry->latency >> 8) & 0xFF;
+    buf[5] = entry->timeout & 0xFF;
+    buf[6] = (entry->timeout >> 8) & 0xFF;
+    buf[7] = entry->mtu & 0xFF;
+    buf[8] = (entry->mtu >> 8) & 0xFF;
+    return LINK_DIAGNOSTICS_SIZE;
+}
+
+void link_diagnostics_update(uint8_t connection) {
+    uint8_t buf[LINK_DIAGNOSTICS_SIZE];
+    const connection_entry_t *entry = connection_table_find(connection);
+
+    if (!connection_table_is_subscribed(entry, gattdb_link_diagnostics)) {
+        return;
+    }
+    size_t len = link_diagnostics_encode(connection, buf);
+    notify_queue_send(connection, gattdb_link_diagnostics, len, buf);
+}
@@ -0,0 +1,21 @@
+#ifndef LINK_DIAGNOSTICS_H
+#define LINK_DIAGNOSTICS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Link Diagnostics value (little-endian):
+//   uint8  phy          1 = 1M, 2 = 2M, 4 = Coded
+//   uint16 interval     1.25 ms
+//   uint16 latency      connection events
+//   uint16 timeout      10 ms
+//   uint16 mtu          ATT MTU
+#define LINK_DIAGNOSTICS_SIZE 9
+
+// Encode the state of one connection. Returns the length, 0 if unknown.
+size_t link_diagnostics_encode(uint8_t connection, uint8_t *buf);
+
+// Notify the connection's own state to it, if it subscribed.
+void link_diagnostics_update(uint8_t connection);
+
+#endif // LINK_DIAGNOSTICS_H
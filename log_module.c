@@ -0,0 +1,40 @@
+#include "log_module.h"
+
+uint8_t log_module_level[LOG_MODULE_COUNT] = {
+    [LOG_MODULE_APP] = LOG_MODULE_APP_LEVEL,
+    [LOG_MODULE_SENSOR] = LOG_MODULE_SENSOR_LEVEL,
+    [LOG_MODULE_LINK] = LOG_MODULE_LINK_LEVEL,
+    [LOG_MODULE_HISTORY] = LOG_MODULE_HISTORY_LEVEL,
+    [LOG_MODULE_DIAGNOSTICS] = LOG_MODULE_DIAGNOSTICS_LEVEL,
+};
+
+sl_status_t log_module_set_level(log_module_t module, uint8_t level) {
+    if (module >= LOG_MODULE_COUNT || level > LOG_LEVEL_OFF) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    log_module_level[module] = level;
+    return SL_STATUS_OK;
+}
+
+size_t log_module_encode(uint8_t *buf) {
+    for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+        buf[module] = log_module_level[module];
+    }
+    return LOG_MODULE_ENCODED_SIZE;
+}
+
+sl_status_t log_module_decode(const uint8_t *buf, size_t len) {
+    if (len != LOG_MODULE_ENCODED_SIZE) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    // Validate everything first so a bad write changes nothing.
+    for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+        if (buf[module] > LOG_LEVEL_OFF) {
+            return SL_STATUS_INVALID_RANGE;
+        }
+    }
+    for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+        log_module_level[module] = buf[module];
+    }
+    return SL_STATUS_OK;
+}
@@ -0,0 +1,54 @@
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sl_status.h>
+#include "app_log.h"
+
+#define LOG_LEVEL_OFF   (APP_LOG_LEVEL_CRITICAL + 1)
+
+#include "log_module_config.h"
+
+typedef enum {
+    LOG_MODULE_APP,
+    LOG_MODULE_SENSOR,
+    LOG_MODULE_LINK,
+    LOG_MODULE_HISTORY,
+    LOG_MODULE_DIAGNOSTICS,
+    LOG_MODULE_COUNT
+} log_module_t;
+
+// Runtime threshold per module, indexed by log_module_t.
+extern uint8_t log_module_level[LOG_MODULE_COUNT];
+
+// Log Levels value: one level byte per module in log_module_t order.
+#define LOG_MODULE_ENCODED_SIZE LOG_MODULE_COUNT
+
+// Levels below the build threshold stay off whatever is set here.
+sl_status_t log_module_set_level(log_module_t module, uint8_t level);
+size_t log_module_encode(uint8_t *buf);
+sl_status_t log_module_decode(const uint8_t *buf, size_t len);
+
+/**************************************************************************/
+/* Each source file defines LOG_MODULE to a module name (APP, LINK, ...)  */
+/* before including this header. A message is printed when its level      */
+/* reaches both the build threshold LOG_MODULE_<name>_LEVEL and the       */
+/* runtime level. The first test is a constant, so the compiler drops     */
+/* the call, its format string and its arguments when it fails.           */
+/**************************************************************************/
+#define LOG_BUILD_LEVEL_(name)   LOG_MODULE_##name##_LEVEL
+#define LOG_BUILD_LEVEL(name)    LOG_BUILD_LEVEL_(name)
+#define LOG_MODULE_ID_(name)     LOG_MODULE_##name
+#define LOG_MODULE_ID(name)      LOG_MODULE_ID_(name)
+
+#define LOG_ON(level)                                   \
+    ((level) >= LOG_BUILD_LEVEL(LOG_MODULE)             \
+     && (level) >= log_module_level[LOG_MODULE_ID(LOG_MODULE)])
+
+#define LOG_DEBUG(...)    do { if (LOG_ON(APP_LOG_LEVEL_DEBUG)) { app_log_debug(__VA_ARGS__); } } while (0)
+#define LOG_INFO(...)     do { if (LOG_ON(APP_LOG_LEVEL_INFO)) { app_log_info(__VA_ARGS__); } } while (0)
+#define LOG_WARNING(...)  do { if (LOG_ON(APP_LOG_LEVEL_WARNING)) { app_log_warning(__VA_ARGS__); } } while (0)
+#define LOG_ERROR(...)    do { if (LOG_ON(APP_LOG_LEVEL_ERROR)) { app_log_error(__VA_ARGS__); } } while (0)
+
+#endif // LOG_MODULE_H
@@ -0,0 +1,68 @@
+#include <stddef.h>
+#include "sl_bluetooth.h"
+#define LOG_MODULE APP
+#include "log_module.h"
+#include "measurement_interval.h"
+#include "measurement_interval_config.h"
+#include "sensor_scheduler.h"
+
+static uint16_t interval_s = MEASUREMENT_INTERVAL_DEFAULT_S;
+
+/**************************************************************************/
+/* Apply Interval to Scheduler                                            */
+/**************************************************************************/
+static void apply(uint16_t seconds) {
+    for (int id = 0; id < SENSOR_ID_COUNT; id++) {
+        sensor_scheduler_set_period_ms((sensor_id_t)id, (uint32_t)seconds * 1000UL);
+    }
+}
+
+/**************************************************************************/
+/* Init                                                                   */
+/**************************************************************************/
+sl_status_t measurement_interval_init(void) {
+    uint8_t data[2];
+    size_t len = 0;
+
+    sl_status_t sc = sl_bt_nvm_load(MEASUREMENT_INTERVAL_NVM_KEY, sizeof(data), &len, data);
+    if (sc == SL_STATUS_OK && len == sizeof(data)) {
+        uint16_t stored = (uint16_t)(data[0] | (data[1] << 8));
+        if (stored >= MEASUREMENT_INTERVAL_MIN_S) {
+            interval_s = stored;
+        }
+    }
+    apply(interval_s);
+    LOG_INFO("Measurement interval: %u s.\n", interval_s);
+    return SL_STATUS_OK;
+}
+
+/**************************************************************************/
+/* Accessors                                                              */
+/**************************************************************************/
+uint16_t measurement_interval_get(void) {
+    return interval_s;
+}
+
+sl_status_t measurement_interval_set(uint32_t seconds) {
+    uint8_t data[2];
+
+    if (seconds < MEASUREMENT_INTERVAL_MIN_S || seconds > MEASUREMENT_INTERVAL_MAX_S) {
+        return SL_STATUS_INVALID_RANGE;
+    }
+    if (seconds == interval_s) {
+        return SL_STATUS_OK;
+    }
+
+    interval_s = (uint16_t)seconds;
+    apply(interval_s);
+
+    // Flash is only written when the value actually changes.
+    data[0] = interval_s & 0xFF;
+    data[1] = (interval_s >> 8) & 0xFF;
+    sl_status_t sc = sl_bt_nvm_save(MEASUREMENT_INTERVAL_NVM_KEY, sizeof(data), data);
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to persist measurement interval: 0x%lX\n", sc);
+    }
+    LOG_INFO("Measurement interval set to %u s.\n", interval_s);
+    return SL_STATUS_OK;
+}
@@ -0,0 +1,22 @@
+#ifndef MEASUREMENT_INTERVAL_H
+#define MEASUREMENT_INTERVAL_H
+
+#include <stdint.h>
+#include <sl_status.h>
+
+// Range of the Measurement Interval characteristic (2A21), in seconds.
+#define MEASUREMENT_INTERVAL_MIN_S   1
+#define MEASUREMENT_INTERVAL_MAX_S   65535
+
+// Restore the persisted interval (or the default) and apply it to the
+// sampling scheduler. Needs the Bluetooth stack to be up (system_boot).
+sl_status_t measurement_interval_init(void);
+
+// Current interval in seconds.
+uint16_t measurement_interval_get(void);
+
+// Apply a new interval to every sensor without losing the current phase,
+// and persist it. SL_STATUS_INVALID_RANGE if out of bounds.
+sl_status_t measurement_interval_set(uint32_t seconds);
+
+#endif // MEASUREMENT_INTERVAL_H
@@ -0,0 +1,231 @@
+#include <stdbool.h>
+#include <string.h>
+#include "em_core.h"
+#include "sl_bluetooth.h"
+#include "gatt_db.h"
+#include "connection_table.h"
+#include "app_scheduler.h"
+#include "notify_queue.h"
+#include "notify_queue_config.h"
+#define LOG_MODULE LINK
+#include "log_module.h"
+
+// Characteristics whose notifications carry a current value, so only the
+// latest one matters. The index in this table is the bit position in
+// queue_slot_t.pending_mask.
+static const uint16_t queued_characteristics[] = {
+    gattdb_temperature,
+    gattdb_humidity_0,
+    gattdb_irradiance_0,
+    gattdb_link_diagnostics,
+};
+
+#define QUEUED_COUNT (sizeof(queued_characteristics) / sizeof(queued_characteristics[0]))
+
+// The stack reports no completion for notifications; a value counts as
+// delivered once sl_bt_gatt_server_send_notification() accepts it. What is
+// outstanding per connection is what it has refused so far.
+typedef struct {
+    uint8_t connection;          // CONNECTION_HANDLE_INVALID when the slot is free
+    uint32_t pending_mask;       // one bit per queued characteristic
+    uint8_t len[QUEUED_COUNT];
+    uint8_t value[QUEUED_COUNT][NOTIFY_QUEUE_MAX_VALUE];
+} queue_slot_t;
+
+static queue_slot_t slots[CONNECTION_TABLE_SIZE];
+static notify_queue_stats_t stats;
+static uint32_t pending_count = 0;
+static app_job_t *retry_job = NULL;
+
+static int queued_index(uint16_t characteristic) {
+    for (size_t i = 0; i < QUEUED_COUNT; i++) {
+        if (queued_characteristics[i] == characteristic) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static queue_slot_t *find_slot(uint8_t connection) {
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        if (slots[i].connection == connection) {
+            return &slots[i];
+        }
+    }
+    return NULL;
+}
+
+static void arm_retry(void) {
+    // Keeps an earlier deadline, so a stream of refusals cannot postpone
+    // the retry indefinitely.
+    app_scheduler_post_in(retry_job, NOTIFY_QUEUE_RETRY_MS);
+}
+
+static void release(queue_slot_t *slot, int index) {
+    slot->pending_mask &= ~(1UL << index);
+    pending_count--;
+    if (slot->pending_mask == 0) {
+        slot->connection = CONNECTION_HANDLE_INVALID;
+    }
+}
+
+/**************************************************************************/
+/* Offer the queued values of one connection in characteristic order.     */
+/* Stops at the first refusal: the others would be refused as well.       */
+/* Returns false if values are still waiting.                             */
+/**************************************************************************/
+static bool flush_slot(queue_slot_t *slot) {
+    for (size_t i = 0; i < QUEUED_COUNT && slot->connection != CONNECTION_HANDLE_INVALID; i++) {
+        if (!(slot->pending_mask & (1UL << i))) {
+            continue;
+        }
+        // Unsubscribed since it was queued; the peer no longer wants it.
+        if (!connection_table_is_subscribed(connection_table_find(slot->connection),
+                                            queued_characteristics[i])) {
+            release(slot, (int)i);
+            continue;
+        }
+        stats.retries++;
+        sl_status_t sc = sl_bt_gatt_server_send_notification(slot->connection,
+                                                             queued_characteristics[i],
+                                                             slot->len[i],
+                                                             slot->value[i]);
+        if (sc == SL_STATUS_NO_MORE_RESOURCE) {
+            return false;
+        }
+        if (sc == SL_STATUS_OK) {
+            stats.sent++;
+        } else {
+            stats.dropped++;
+            LOG_ERROR("Queued notification to connection %u failed: 0x%lX\n",
+                      slot->connection, sc);
+        }
+        release(slot, (int)i);
+    }
+    return true;
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t notify_queue_init(app_job_t *job) {
+    retry_job = job;
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        slots[i].connection = CONNECTION_HANDLE_INVALID;
+        slots[i].pending_mask = 0;
+    }
+    pending_count = 0;
+    memset(&stats, 0, sizeof(stats));
+    return SL_STATUS_OK;
+}
+
+sl_status_t notify_queue_send(uint8_t connection, uint16_t characteristic, size_t len, const uint8_t *data) {
+    int index = queued_index(characteristic);
+    queue_slot_t *slot;
+
+    if (index < 0) {
+        return SL_STATUS_NOT_SUPPORTED;
+    }
+    if (len > NOTIFY_QUEUE_MAX_VALUE || connection == CONNECTION_HANDLE_INVALID) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+    slot = find_slot(connection);
+    // Older values go first, so only try directly when none are waiting.
+    if (slot == NULL) {
+        sl_status_t sc = sl_bt_gatt_server_send_notification(connection, characteristic, len, data);
+        if (sc == SL_STATUS_OK) {
+            stats.sent++;
+            return SL_STATUS_OK;
+        }
+        if (sc != SL_STATUS_NO_MORE_RESOURCE) {
+            stats.dropped++;
+            LOG_ERROR("Notification to connection %u failed: 0x%lX\n", connection, sc);
+            return sc;
+        }
+        slot = find_slot(CONNECTION_HANDLE_INVALID);
+        if (slot == NULL) {
+            stats.dropped++;
+            return SL_STATUS_NO_MORE_RESOURCE;
+        }
+        slot->connection = connection;
+    }
+    if (slot->pending_mask & (1UL << index)) {
+        stats.coalesced++;
+    } else {
+        slot->pending_mask |= (1UL << index);
+        pending_count++;
+        if (pending_count > stats.max_pending) {
+            stats.max_pending = pending_count;
+        }
+    }
+    slot->len[index] = (uint8_t)len;
+    memcpy(slot->value[index], data, len);
+    arm_retry();
+    return SL_STATUS_OK;
+}
+
+void notify_queue_send_all(uint16_t characteristic, size_t len, const uint8_t *data) {
+    for (uint8_t i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        const connection_entry_t *entry = connection_table_at(i);
+        if (connection_table_is_subscribed(entry, characteristic)) {
+            notify_queue_send(entry->handle, characteristic, len, data);
+        }
+    }
+}
+
+void notify_queue_process(void) {
+    bool waiting = false;
+
+    for (int i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        if (slots[i].connection != CONNECTION_HANDLE_INVALID && !flush_slot(&slots[i])) {
+            waiting = true;
+        }
+    }
+    if (waiting) {
+        arm_retry();
+    }
+}
+
+void notify_queue_close(uint8_t connection) {
+    queue_slot_t *slot = (connection != CONNECTION_HANDLE_INVALID) ? find_slot(connection) : NULL;
+
+    if (slot == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < QUEUED_COUNT; i++) {
+        if (slot->pending_mask & (1UL << i)) {
+            stats.dropped++;
+            release(slot, (int)i);
+        }
+    }
+}
+
+uint32_t notify_queue_pending(void) {
+    return pending_count;
+}
+
+void notify_queue_get_stats(notify_queue_stats_t *out) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    *out = stats;
+    CORE_EXIT_ATOMIC();
+}
+
+void notify_queue_log(void) {
+    notify_queue_stats_t snapshot;
+    uint32_t pending;
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    snapshot = stats;
+    pending = pending_count;
+    CORE_EXIT_ATOMIC();
+    LOG_INFO("Notify queue: %lu sent, %lu retries, %lu coalesced, %lu dropped, %lu pending (max %lu).\n",
+             (unsigned long)snapshot.sent,
+             (unsigned long)snapshot.retries,
+             (unsigned long)snapshot.coalesced,
+             (unsigned long)snapshot.dropped,
+             (unsigned long)pending,
+             (unsigned long)snapshot.max_pending);
+}
@@ -0,0 +1,43 @@
+#ifndef NOTIFY_QUEUE_H
+#define NOTIFY_QUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sl_status.h>
+#include "app_scheduler.h"
+
+typedef struct {
+    uint32_t sent;               // values accepted by the stack
+    uint32_t retries;            // sends repeated after SL_STATUS_NO_MORE_RESOURCE
+    uint32_t coalesced;          // queued values superseded before they went out
+    uint32_t dropped;            // values lost to other errors or closed connections
+    uint32_t max_pending;        // high-water mark of values waiting at once
+} notify_queue_stats_t;
+
+// Initialise the queue. retry_job is posted when values refused by the
+// stack are due to be offered again; its handler calls notify_queue_process().
+sl_status_t notify_queue_init(app_job_t *retry_job);
+
+// Notify a value of a latest-value-wins characteristic to one connection.
+// If the stack is out of buffers, or older values still wait for this
+// connection, the value is queued; a newer value of the same characteristic
+// replaces it. Returns SL_STATUS_NOT_SUPPORTED for characteristics that are
+// not queued and SL_STATUS_INVALID_PARAMETER for oversized values.
+sl_status_t notify_queue_send(uint8_t connection, uint16_t characteristic, size_t len, const uint8_t *data);
+
+// Same, for every peer subscribed to the characteristic.
+void notify_queue_send_all(uint16_t characteristic, size_t len, const uint8_t *data);
+
+// Offer queued values to the stack again.
+void notify_queue_process(void);
+
+// Forget everything queued for a closed connection.
+void notify_queue_close(uint8_t connection);
+
+// Values currently waiting, over all connections.
+uint32_t notify_queue_pending(void);
+
+void notify_queue_get_stats(notify_queue_stats_t *out);
+void notify_queue_log(void);
+
+#endif // NOTIFY_QUEUE_H
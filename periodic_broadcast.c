@@ -0,0 +1,121 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include "sl_bluetooth.h"
+#define LOG_MODULE LINK
+#include "log_module.h"
+#include "app_clock.h"
+#include "periodic_broadcast.h"
+#include "periodic_broadcast_config.h"
+
+#define HEADER_SIZE      6
+#define RECORD_SIZE      5
+#define PAYLOAD_SIZE     (HEADER_SIZE + RECORD_SIZE * PERIODIC_BROADCAST_RECORDS)
+
+typedef struct {
+    uint32_t timestamp_ms;
+    uint16_t value;
+    uint8_t sensor;
+} record_t;
+
+static record_t window[PERIODIC_BROADCAST_RECORDS];
+static uint32_t head = 0;       // next slot to write
+static uint32_t count = 0;
+static uint16_t sequence = 0;
+static bool dirty = false;
+static uint8_t advertising_handle = 0xff;
+
+/**************************************************************************/
+/* Payload Encoding                                                       */
+/**************************************************************************/
+static size_t encode(uint8_t *buf) {
+    uint32_t newest = (head + PERIODIC_BROADCAST_RECORDS - 1) % PERIODIC_BROADCAST_RECORDS;
+    uint32_t n = (count > 0) ? 1 : 0;
+    size_t len = 0;
+
+    // Walk back from the newest record, stopping at a gap too long for a
+    // delta; older records cannot be expressed in this payload.
+    while (n < count) {
+        const record_t *record = &window[(newest + PERIODIC_BROADCAST_RECORDS - n + 1) % PERIODIC_BROADCAST_RECORDS];
+        const record_t *previous = &window[(newest + PERIODIC_BROADCAST_RECORDS - n) % PERIODIC_BROADCAST_RECORDS];
+        if (record->timestamp_ms - previous->timestamp_ms > UINT16_MAX) {
+            break;
+        }
+        n++;
+    }
+    uint32_t first = (head + PERIODIC_BROADCAST_RECORDS - n) % PERIODIC_BROADCAST_RECORDS;
+
+    uint32_t previous_ms = (n > 0) ? window[first].timestamp_ms : 0;
+    buf[len++] = sequence & 0xFF;
+    buf[len++] = (sequence >> 8) & 0xFF;
+    buf[len++] = previous_ms & 0xFF;
+    buf[len++] = (previous_ms >> 8) & 0xFF;
+    buf[len++] = (previous_ms >> 16) & 0xFF;
+    buf[len++] = (previous_ms >> 24) & 0xFF;
+    for (uint32_t i = 0; i < n; i++) {
+        const record_t *record = &window[(first + i) % PERIODIC_BROADCAST_RECORDS];
+        uint32_t delta = record->timestamp_ms - previous_ms;
+        buf[len++] = record->sensor;
+        buf[len++] = delta & 0xFF;
+        buf[len++] = (delta >> 8) & 0xFF;
+        buf[len++] = record->value & 0xFF;
+        buf[len++] = (record->value >> 8) & 0xFF;
+        previous_ms = record->timestamp_ms;
+    }
+    return len;
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t periodic_broadcast_start(void) {
+    sl_status_t sc = sl_bt_advertiser_create_set(&advertising_handle);
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to create periodic advertising set: 0x%lX\n", sc);
+        return sc;
+    }
+    sl_bt_advertiser_set_timing(advertising_handle,
+                                PERIODIC_BROADCAST_ADV_INTERVAL,
+                                PERIODIC_BROADCAST_ADV_INTERVAL,
+                                0,
+                                0);
+    sl_bt_extended_advertiser_generate_data(advertising_handle, sl_bt_advertiser_general_discoverable);
+    // The extended advertisements carrying the SyncInfo that points
+    // scanners to the train are started together with it.
+    sc = sl_bt_periodic_advertiser_start(advertising_handle,
+                                         PERIODIC_BROADCAST_INTERVAL,
+                                         PERIODIC_BROADCAST_INTERVAL,
+                                         SL_BT_PERIODIC_ADVERTISER_AUTO_START_EXTENDED_ADVERTISING);
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to start periodic advertising: 0x%lX\n", sc);
+        return sc;
+    }
+    dirty = true;
+    return periodic_broadcast_refresh();
+}
+
+void periodic_broadcast_push(sensor_id_t sensor, uint16_t value) {
+    window[head].timestamp_ms = app_clock_ms();
+    window[head].value = value;
+    window[head].sensor = (uint8_t)sensor;
+    head = (head + 1) % PERIODIC_BROADCAST_RECORDS;
+    if (count < PERIODIC_BROADCAST_RECORDS) {
+        count++;
+    }
+    sequence++;
+    dirty = true;
+}
+
+sl_status_t periodic_broadcast_refresh(void) {
+    uint8_t buf[PAYLOAD_SIZE];
+
+    if (!dirty || advertising_handle == 0xff) {
+        return SL_STATUS_OK;
+    }
+    dirty = false;
+    size_t len = encode(buf);
+    sl_status_t sc = sl_bt_periodic_advertiser_set_data(advertising_handle, len, buf);
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to set periodic advertising data: 0x%lX\n", sc);
+    }
+    return sc;
+}
@@ -0,0 +1,27 @@
+#ifndef PERIODIC_BROADCAST_H
+#define PERIODIC_BROADCAST_H
+
+#include <stdint.h>
+#include <sl_status.h>
+#include "sensor_scheduler.h"
+
+// Periodic advertising data (little-endian):
+//   uint16 sequence     number of samples published so far; the records
+//                       are samples sequence-n+1 .. sequence
+//   uint32 base_ms      timestamp of the first record, ms since boot
+//   records[n]          uint8 sensor id, uint16 ms since previous record,
+//                       uint16 value in the sensor characteristic's format
+// The window slides by one record per sample, so a scanner that misses
+// events still recovers every sample it has not seen.
+
+// Create the extended advertising set and start the periodic train.
+sl_status_t periodic_broadcast_start(void);
+
+// Append one sample to the published window.
+void periodic_broadcast_push(sensor_id_t sensor, uint16_t value);
+
+// Update the periodic advertising data if samples were pushed since the
+// last call.
+sl_status_t periodic_broadcast_refresh(void);
+
+#endif // PERIODIC_BROADCAST_H
@@ -0,0 +1,33 @@
+#include <stddef.h>
+#include "sl_bluetooth.h"
+#define LOG_MODULE LINK
+#include "log_module.h"
+#include "connection_table.h"
+#include "phy_policy.h"
+#include "phy_policy_config.h"
+
+// Accept whatever the central settles on; the preference is only a hint.
+#define PHY_POLICY_ACCEPT_ANY   0xff
+
+void phy_policy_request(uint8_t connection, phy_policy_mode_t mode) {
+    connection_entry_t *entry = connection_table_find(connection);
+    if (entry == NULL || entry->phy_mode == mode) {
+        return;
+    }
+    entry->phy_mode = mode;
+    uint8_t preferred = (mode == PHY_POLICY_MODE_BULK) ? PHY_POLICY_BULK_PHY : PHY_POLICY_RANGE_PHY;
+    sl_status_t sc = sl_bt_connection_set_preferred_phy(connection, preferred, PHY_POLICY_ACCEPT_ANY);
+    if (sc != SL_STATUS_OK) {
+        LOG_ERROR("Failed to request PHY 0x%X: 0x%lX\n", preferred, sc);
+        entry->phy_mode = PHY_POLICY_MODE_NONE;
+    }
+}
+
+void phy_policy_on_phy_status(uint8_t connection, uint8_t phy) {
+    connection_entry_t *entry = connection_table_find(connection);
+    if (entry == NULL) {
+        return;
+    }
+    entry->phy = phy;
+    LOG_INFO("Connection %u PHY changed to 0x%X.\n", connection, phy);
+}
@@ -0,0 +1,19 @@
+#ifndef PHY_POLICY_H
+#define PHY_POLICY_H
+
+#include <stdint.h>
+
+typedef enum {
+    PHY_POLICY_MODE_NONE,       // nothing requested yet
+    PHY_POLICY_MODE_RANGE,      // sensor traffic, favour link budget
+    PHY_POLICY_MODE_BULK        // bulk transfer, favour air time
+} phy_policy_mode_t;
+
+// Ask the central for the PHY configured for the mode. Each connection is
+// asked again only when its mode changes.
+void phy_policy_request(uint8_t connection, phy_policy_mode_t mode);
+
+// Record the PHY from sl_bt_evt_connection_phy_status.
+void phy_policy_on_phy_status(uint8_t connection, uint8_t phy);
+
+#endif // PHY_POLICY_H
@@ -0,0 +1,37 @@
+#include "profiler.h"
+
+#if PROFILER_ENABLE
+
+#include "em_device.h"
+#include "sl_debug_swo.h"
+#include "cycle_counter.h"
+
+#define PROFILER_TIMESTAMP_MASK    0x00FFFFFFUL
+
+static uint32_t dropped = 0;
+
+void profiler_init(void) {
+    cycle_counter_init();
+    sl_debug_swo_enable_itm(PROFILER_ITM_CHANNEL);
+}
+
+void profiler_edge(profiler_zone_t zone, uint32_t begin) {
+    uint32_t word = ((uint32_t)zone << 25)
+                    | ((begin & 1UL) << 24)
+                    | (cycle_counter_get() & PROFILER_TIMESTAMP_MASK);
+
+    // A stimulus port reads 0 while its FIFO entry is busy.
+    if (!(ITM->TCR & ITM_TCR_ITMENA_Msk)
+        || !(ITM->TER & (1UL << PROFILER_ITM_CHANNEL))
+        || ITM->PORT[PROFILER_ITM_CHANNEL].u32 == 0) {
+        dropped++;
+        return;
+    }
+    ITM->PORT[PROFILER_ITM_CHANNEL].u32 = word;
+}
+
+uint32_t profiler_dropped(void) {
+    return dropped;
+}
+
+#endif // PROFILER_ENABLE
@@ -0,0 +1,48 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include "profiler_config.h"
+
+/**************************************************************************/
+/* Hot-path profiler.                                                     */
+/*                                                                        */
+/* Each zone edge is one 32-bit word on ITM stimulus port                 */
+/* PROFILER_ITM_CHANNEL, decoded on the host from the SWO stream:         */
+/*   bits 31..25  zone (profiler_zone_t)                                  */
+/*   bit  24      1 = begin, 0 = end                                      */
+/*   bits 23..0   DWT cycle counter, low 24 bits                          */
+/* The timestamp wraps every 2^24 cycles (437 ms at 38.4 MHz), so a zone  */
+/* duration is (end - begin) mod 2^24 for zones shorter than that.        */
+/* Words are dropped, not waited for, when the ITM FIFO is full or no     */
+/* debugger enabled the port. tools/profiler_decode.py turns a raw SWO    */
+/* capture into per-zone duration histograms.                            */
+/**************************************************************************/
+
+typedef enum {
+    PROFILER_ZONE_LIGHT_READ,       // blocking Si1133 read
+    PROFILER_ZONE_RHT_RESULT,       // RHT result to notifications
+    PROFILER_ZONE_NOTIFY,           // one notification fan-out
+    PROFILER_ZONE_LOG,              // app_log in the sample path
+    PROFILER_ZONE_HISTORY,          // history log append and page commit
+    PROFILER_ZONE_COUNT
+} profiler_zone_t;
+
+#if PROFILER_ENABLE
+
+void profiler_init(void);
+void profiler_edge(profiler_zone_t zone, uint32_t begin);
+uint32_t profiler_dropped(void);
+
+#define PROFILER_BEGIN(zone)   profiler_edge((zone), 1)
+#define PROFILER_END(zone)     profiler_edge((zone), 0)
+
+#else
+
+#define profiler_init()        ((void)0)
+#define PROFILER_BEGIN(zone)   ((void)0)
+#define PROFILER_END(zone)     ((void)0)
+
+#endif // PROFILER_ENABLE
+
+#endif // PROFILER_H
@@ -0,0 +1,178 @@
+#include <stddef.h>
+#include "em_core.h"
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#include "rht_async.h"
+#include "rht_async_bus.h"
+#include "rht_async_config.h"
+
+// Si7021 commands
+#define SI7021_CMD_MEASURE_RH_NO_HOLD     0xF5
+#define SI7021_CMD_READ_TEMP_FROM_RH      0xE0
+
+typedef enum {
+    RHT_ASYNC_STATE_IDLE,
+    RHT_ASYNC_STATE_MEASURE_CMD,   // "measure RH" command on the bus
+    RHT_ASYNC_STATE_CONVERTING,    // waiting on the sleeptimer, bus idle
+    RHT_ASYNC_STATE_READ_RH,       // reading back the RH result
+    RHT_ASYNC_STATE_READ_TEMP      // reading the temperature taken with it
+} rht_async_state_t;
+
+static volatile rht_async_state_t state = RHT_ASYNC_STATE_IDLE;
+static uint32_t done_signal = 0;
+static uint8_t retries;
+static uint8_t tx_buf[1];
+static uint8_t rx_buf[2];
+static uint32_t raw_rh;
+static sl_sleeptimer_timer_handle_t conversion_timer;
+static rht_async_result_t result = { .status = SL_STATUS_NOT_READY };
+
+static void on_bus_complete(sl_status_t status);
+
+/**************************************************************************/
+/* Finish Acquisition                                                     */
+/**************************************************************************/
+static void finish(sl_status_t status, uint32_t rh, int32_t temperature) {
+    result.status = status;
+    result.rh = rh;
+    result.temperature = temperature;
+    result.done_tick = sl_sleeptimer_get_tick_count();
+    state = RHT_ASYNC_STATE_IDLE;
+    sl_bt_external_signal(done_signal);
+}
+
+/**************************************************************************/
+/* Conversion Timer Callback                                              */
+/**************************************************************************/
+static void conversion_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    state = RHT_ASYNC_STATE_READ_RH;
+    sl_status_t sc = rht_async_bus_transfer(RHT_ASYNC_I2C_ADDRESS,
+                                            NULL, 0,
+                                            rx_buf, sizeof(rx_buf),
+                                            on_bus_complete);
+    if (sc != SL_STATUS_OK) {
+        finish(sc, 0, 0);
+    }
+}
+
+static void arm_conversion_timer(uint32_t delay_ms) {
+    state = RHT_ASYNC_STATE_CONVERTING;
+    sl_status_t sc = sl_sleeptimer_start_timer_ms(&conversion_timer,
+                                                  delay_ms,
+                                                  conversion_timer_callback,
+                                                  NULL,
+                                                  0,
+                                                  0);
+    if (sc != SL_STATUS_OK) {
+        finish(sc, 0, 0);
+    }
+}
+
+/**************************************************************************/
+/* Bus Completion Callback                                                */
+/**************************************************************************/
+static void on_bus_complete(sl_status_t status) {
+    sl_status_t sc;
+
+    switch (state) {
+    case RHT_ASYNC_STATE_MEASURE_CMD:
+        if (status != SL_STATUS_OK) {
+            finish(status, 0, 0);
+            break;
+        }
+        retries = 0;
+        arm_conversion_timer(RHT_ASYNC_CONVERSION_TIME_MS);
+        break;
+
+    case RHT_ASYNC_STATE_READ_RH:
+        if (status == SL_STATUS_NOT_READY && retries < RHT_ASYNC_MAX_RETRIES) {
+            // Sensor NACKs its read address until the conversion is done.
+            retries++;
+            arm_conversion_timer(RHT_ASYNC_RETRY_DELAY_MS);
+            break;
+        }
+        if (status != SL_STATUS_OK) {
+            finish(status, 0, 0);
+            break;
+        }
+        raw_rh = ((uint32_t)rx_buf[0] << 8) | rx_buf[1];
+        state = RHT_ASYNC_STATE_READ_TEMP;
+        tx_buf[0] = SI7021_CMD_READ_TEMP_FROM_RH;
+        sc = rht_async_bus_transfer(RHT_ASYNC_I2C_ADDRESS,
+                                    tx_buf, 1,
+                                    rx_buf, sizeof(rx_buf),
+                                    on_bus_complete);
+        if (sc != SL_STATUS_OK) {
+            finish(sc, 0, 0);
+        }
+        break;
+
+    case RHT_ASYNC_STATE_READ_TEMP:
+        if (status != SL_STATUS_OK) {
+            finish(status, 0, 0);
+            break;
+        }
+        {
+            int32_t raw_temp = ((int32_t)rx_buf[0] << 8) | rx_buf[1];
+            // Same conversions as the si70xx driver, in milli-units.
+            int32_t rh = (int32_t)((raw_rh * 15625UL) >> 13) - 6000;
+            int32_t temperature = ((raw_temp * 21965L) >> 13) - 46850;
+            if (rh < 0) {
+                rh = 0;
+            } else if (rh > 100000) {
+                rh = 100000;
+            }
+            finish(SL_STATUS_OK, (uint32_t)rh, temperature);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t rht_async_init(uint32_t signal) {
+    done_signal = signal;
+    state = RHT_ASYNC_STATE_IDLE;
+    return rht_async_bus_init();
+}
+
+sl_status_t rht_async_start(void) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    if (state != RHT_ASYNC_STATE_IDLE) {
+        CORE_EXIT_ATOMIC();
+        return SL_STATUS_BUSY;
+    }
+    state = RHT_ASYNC_STATE_MEASURE_CMD;
+    CORE_EXIT_ATOMIC();
+
+    result.start_tick = sl_sleeptimer_get_tick_count();
+    tx_buf[0] = SI7021_CMD_MEASURE_RH_NO_HOLD;
+    sl_status_t sc = rht_async_bus_transfer(RHT_ASYNC_I2C_ADDRESS,
+                                            tx_buf, 1,
+                                            NULL, 0,
+                                            on_bus_complete);
+    if (sc != SL_STATUS_OK) {
+        state = RHT_ASYNC_STATE_IDLE;
+    }
+    return sc;
+}
+
+bool rht_async_is_busy(void) {
+    return state != RHT_ASYNC_STATE_IDLE;
+}
+
+void rht_async_get_result(rht_async_result_t *out) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    *out = result;
+    CORE_EXIT_ATOMIC();
+}
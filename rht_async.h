@@ -0,0 +1,34 @@
+#ifndef RHT_ASYNC_H
+#define RHT_ASYNC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sl_status.h>
+
+// Outcome of the last acquisition. Units match sl_sensor_rht_get():
+// relative humidity in milli-percent, temperature in milli-degrees Celsius.
+typedef struct {
+    sl_status_t status;
+    uint32_t rh;
+    int32_t temperature;
+    uint32_t start_tick;   // sleeptimer tick when rht_async_start() was called
+    uint32_t done_tick;    // sleeptimer tick when the result was posted
+} rht_async_result_t;
+
+// Initialise the state machine. done_signal is the external signal bit
+// posted through sl_bt_external_signal() when an acquisition completes.
+// Must be called after sl_sensor_rht_init().
+sl_status_t rht_async_init(uint32_t done_signal);
+
+// Kick off a measurement: start conversion, wait for it on a sleeptimer,
+// read back over interrupt-driven I2C. Returns immediately.
+// SL_STATUS_BUSY if an acquisition is already running.
+sl_status_t rht_async_start(void);
+
+// True while an acquisition is in flight (the sensor I2C bus is in use).
+bool rht_async_is_busy(void);
+
+// Copy out the last completed acquisition.
+void rht_async_get_result(rht_async_result_t *result);
+
+#endif // RHT_ASYNC_H
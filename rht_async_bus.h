@@ -0,0 +1,34 @@
+#ifndef RHT_ASYNC_BUS_H
+#define RHT_ASYNC_BUS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sl_status.h>
+
+/**************************************************************************/
+/* I2C transport used by the asynchronous RHT state machine.              */
+/*                                                                        */
+/* The state machine in rht_async.c only talks to the sensor through this */
+/* interface, so the transport can be swapped for a simulated bus when    */
+/* the state machine is built off-target.                                 */
+/**************************************************************************/
+
+// Called once per transfer, from interrupt context on target.
+// SL_STATUS_OK on success, SL_STATUS_NOT_READY when the slave NACKed its
+// address (Si7021 conversion still running), SL_STATUS_IO otherwise.
+typedef void (*rht_async_bus_callback_t)(sl_status_t status);
+
+// Prepare the peripheral for interrupt-driven transfers.
+sl_status_t rht_async_bus_init(void);
+
+// Start a transfer: write tx_len bytes (may be 0), then read rx_len bytes
+// (may be 0) with a repeated start. Returns SL_STATUS_BUSY if a transfer is
+// already in flight; callback is only invoked when SL_STATUS_OK is returned.
+sl_status_t rht_async_bus_transfer(uint16_t address,
+                                   const uint8_t *tx,
+                                   size_t tx_len,
+                                   uint8_t *rx,
+                                   size_t rx_len,
+                                   rht_async_bus_callback_t callback);
+
+#endif // RHT_ASYNC_BUS_H
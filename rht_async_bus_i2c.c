@@ -0,0 +1,109 @@
+#include <stdbool.h>
+#include "em_i2c.h"
+#include "em_core.h"
+#include "sl_power_manager.h"
+#include "sl_i2cspm_sensor_config.h"
+#include "rht_async_bus.h"
+
+// The IRQ handler name below is tied to the peripheral instance.
+#if (SL_I2CSPM_SENSOR_PERIPHERAL_NO != 1)
+#error "rht_async_bus_i2c.c expects the sensor I2CSPM instance on I2C1."
+#endif
+
+static I2C_TransferSeq_TypeDef transfer_seq;
+static rht_async_bus_callback_t transfer_callback = NULL;
+static volatile bool transfer_busy = false;
+
+/**************************************************************************/
+/* Init                                                                   */
+/**************************************************************************/
+sl_status_t rht_async_bus_init(void) {
+    // The peripheral itself is set up by sl_i2cspm_init_instances(). The
+    // NVIC line stays disabled between our transfers so that blocking
+    // I2CSPM transfers issued by other drivers on the same bus (Si1133)
+    // keep working by polling.
+    NVIC_DisableIRQ(I2C1_IRQn);
+    NVIC_ClearPendingIRQ(I2C1_IRQn);
+    transfer_busy = false;
+    return SL_STATUS_OK;
+}
+
+/**************************************************************************/
+/* Start Transfer                                                         */
+/**************************************************************************/
+sl_status_t rht_async_bus_transfer(uint16_t address,
+                                   const uint8_t *tx,
+                                   size_t tx_len,
+                                   uint8_t *rx,
+                                   size_t rx_len,
+                                   rht_async_bus_callback_t callback) {
+    CORE_DECLARE_IRQ_STATE;
+
+    if ((tx_len == 0 && rx_len == 0) || callback == NULL) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+
+    CORE_ENTER_ATOMIC();
+    if (transfer_busy) {
+        CORE_EXIT_ATOMIC();
+        return SL_STATUS_BUSY;
+    }
+    transfer_busy = true;
+    CORE_EXIT_ATOMIC();
+
+    transfer_seq.addr = (uint16_t)(address << 1);
+    if (tx_len > 0 && rx_len > 0) {
+        transfer_seq.flags = I2C_FLAG_WRITE_READ;
+    } else if (tx_len > 0) {
+        transfer_seq.flags = I2C_FLAG_WRITE;
+    } else {
+        transfer_seq.flags = I2C_FLAG_READ;
+    }
+    // emlib never writes through the tx buffer.
+    transfer_seq.buf[0].data = (tx_len > 0) ? (uint8_t *)tx : rx;
+    transfer_seq.buf[0].len = (uint16_t)((tx_len > 0) ? tx_len : rx_len);
+    transfer_seq.buf[1].data = rx;
+    transfer_seq.buf[1].len = (uint16_t)rx_len;
+    transfer_callback = callback;
+
+    // The I2C master needs the HF clock: hold EM1 until the transfer ends.
+    sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+
+    NVIC_ClearPendingIRQ(I2C1_IRQn);
+    NVIC_EnableIRQ(I2C1_IRQn);
+    I2C_TransferReturn_TypeDef ret = I2C_TransferInit(I2C1, &transfer_seq);
+    if (ret != i2cTransferInProgress) {
+        NVIC_DisableIRQ(I2C1_IRQn);
+        sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+        transfer_busy = false;
+        return SL_STATUS_IO;
+    }
+    return SL_STATUS_OK;
+}
+
+/**************************************************************************/
+/* I2C1 Interrupt Handler                                                 */
+/**************************************************************************/
+void I2C1_IRQHandler(void) {
+    I2C_TransferReturn_TypeDef ret = I2C_Transfer(I2C1);
+    if (ret == i2cTransferInProgress) {
+        return;
+    }
+
+    NVIC_DisableIRQ(I2C1_IRQn);
+    sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+    transfer_busy = false;
+
+    sl_status_t status;
+    if (ret == i2cTransferDone) {
+        status = SL_STATUS_OK;
+    } else if (ret == i2cTransferNack) {
+        status = SL_STATUS_NOT_READY;
+    } else {
+        status = SL_STATUS_IO;
+    }
+
+    rht_async_bus_callback_t callback = transfer_callback;
+    transfer_callback = NULL;
+    callback(status);
+}
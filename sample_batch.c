@@ -0,0 +1,229 @@
+#include <stddef.h>
+#include "sl_bluetooth.h"
+#include "app_clock.h"
+#include "gatt_db.h"
+#include "connection_table.h"
+#include "app_scheduler.h"
+#include "sample_batch.h"
+#include "sample_batch_config.h"
+
+typedef struct {
+    uint32_t timestamp_ms;
+    uint16_t value;
+    uint8_t sensor;
+} sample_t;
+
+// Delivery state of one Batched Samples subscriber, by connection table
+// slot. cursor counts samples like written, so written - cursor is what
+// the peer has yet to receive.
+typedef struct {
+    uint8_t handle;         // CONNECTION_HANDLE_INVALID when not subscribed
+    uint16_t sequence;      // of the next notification to this peer
+    uint32_t cursor;        // first sample not yet delivered
+} peer_t;
+
+static sample_t ring[SAMPLE_BATCH_RING_SIZE];
+static uint32_t head = 0;       // next slot to write
+static uint32_t count = 0;      // samples some subscriber still needs
+static uint32_t written = 0;    // samples pushed since init
+static uint32_t dropped = 0;
+static peer_t peers[CONNECTION_TABLE_SIZE];
+static bool retry_armed = false;
+static app_job_t *flush_job = NULL;
+
+/**************************************************************************/
+/* Latency Deadline                                                       */
+/**************************************************************************/
+static void arm_latency_deadline(void) {
+    app_scheduler_post_in(flush_job, SAMPLE_BATCH_MAX_LATENCY_MS);
+}
+
+/**************************************************************************/
+/* Subscribers                                                            */
+/**************************************************************************/
+// Follow the connection table: a new subscriber starts at the next sample,
+// one that left no longer holds samples back.
+static void sync_peers(void) {
+    for (uint8_t i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        connection_entry_t *entry = connection_table_at(i);
+        if (entry == NULL || !connection_table_is_subscribed(entry, gattdb_batched_samples)) {
+            peers[i].handle = CONNECTION_HANDLE_INVALID;
+        } else if (peers[i].handle != entry->handle) {
+            peers[i].handle = entry->handle;
+            peers[i].sequence = 0;
+            peers[i].cursor = written;
+        }
+    }
+}
+
+// Samples this peer has yet to receive. Ones already overwritten in the
+// ring are skipped; the peer sees the loss as a jump in base_ms.
+static uint32_t peer_pending(peer_t *peer) {
+    if (written - peer->cursor > count) {
+        peer->cursor = written - count;
+    }
+    return written - peer->cursor;
+}
+
+// The ring keeps what the furthest-behind subscriber still needs.
+static void update_count(void) {
+    uint32_t needed = 0;
+
+    for (uint8_t i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        if (peers[i].handle != CONNECTION_HANDLE_INVALID) {
+            uint32_t pending = peer_pending(&peers[i]);
+            needed = (pending > needed) ? pending : needed;
+        }
+    }
+    count = needed;
+}
+
+/**************************************************************************/
+/* Packing                                                                */
+/**************************************************************************/
+static uint32_t records_per_packet(uint16_t mtu) {
+    size_t payload = (size_t)mtu - 3;
+    if (payload > SAMPLE_BATCH_MAX_PAYLOAD) {
+        payload = SAMPLE_BATCH_MAX_PAYLOAD;
+    }
+    return (uint32_t)((payload - SAMPLE_BATCH_HEADER_SIZE) / SAMPLE_BATCH_RECORD_SIZE);
+}
+
+// Pack up to one notification worth of the samples starting at the
+// peer's cursor into buf. Returns the payload length and the number of
+// samples consumed.
+static size_t pack(uint8_t *buf, uint16_t sequence, uint32_t cursor, uint32_t available,
+                   uint32_t limit, uint32_t *consumed) {
+    uint32_t tail = (head + SAMPLE_BATCH_RING_SIZE - (written - cursor)) % SAMPLE_BATCH_RING_SIZE;
+    uint32_t previous_ms = ring[tail].timestamp_ms;
+    size_t len = 0;
+    uint32_t n = 0;
+
+    buf[len++] = sequence & 0xFF;
+    buf[len++] = (sequence >> 8) & 0xFF;
+    buf[len++] = previous_ms & 0xFF;
+    buf[len++] = (previous_ms >> 8) & 0xFF;
+    buf[len++] = (previous_ms >> 16) & 0xFF;
+    buf[len++] = (previous_ms >> 24) & 0xFF;
+
+    while (n < available && n < limit) {
+        const sample_t *sample = &ring[(tail + n) % SAMPLE_BATCH_RING_SIZE];
+        uint32_t delta = sample->timestamp_ms - previous_ms;
+        if (delta > UINT16_MAX) {
+            break;      // gap too long for a delta, start a new notification
+        }
+        buf[len++] = sample->sensor;
+        buf[len++] = delta & 0xFF;
+        buf[len++] = (delta >> 8) & 0xFF;
+        buf[len++] = sample->value & 0xFF;
+        buf[len++] = (sample->value >> 8) & 0xFF;
+        previous_ms = sample->timestamp_ms;
+        n++;
+    }
+    *consumed = n;
+    return len;
+}
+
+/**************************************************************************/
+/* Delivery                                                               */
+/**************************************************************************/
+// Send every subscriber its pending samples while at least min_records
+// fill a notification for it. A peer whose notification is refused keeps
+// its samples and is retried after SAMPLE_BATCH_RETRY_MS without holding
+// back the others. Returns the most notifications sent to one peer.
+static uint32_t send_pending(uint32_t min_records) {
+    uint8_t buf[SAMPLE_BATCH_MAX_PAYLOAD];
+    uint32_t most_sent = 0;
+
+    retry_armed = false;
+    for (uint8_t i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        peer_t *peer = &peers[i];
+        uint32_t sent = 0;
+
+        if (peer->handle == CONNECTION_HANDLE_INVALID) {
+            continue;
+        }
+        uint32_t limit = records_per_packet(connection_table_at(i)->mtu);
+        uint32_t wanted = (min_records < limit) ? min_records : limit;
+        while (peer_pending(peer) >= wanted && peer_pending(peer) > 0) {
+            uint32_t consumed = 0;
+            size_t len = pack(buf, peer->sequence, peer->cursor, peer_pending(peer), limit, &consumed);
+            if (sl_bt_gatt_server_send_notification(peer->handle, gattdb_batched_samples, len, buf)
+                != SL_STATUS_OK) {
+                retry_armed = true;
+                break;
+            }
+            peer->cursor += consumed;
+            peer->sequence++;
+            sent++;
+        }
+        most_sent = (sent > most_sent) ? sent : most_sent;
+    }
+    update_count();
+    if (retry_armed) {
+        app_scheduler_post_in(flush_job, SAMPLE_BATCH_RETRY_MS);
+    }
+    return most_sent;
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t sample_batch_init(app_job_t *job) {
+    flush_job = job;
+    head = 0;
+    count = 0;
+    written = 0;
+    dropped = 0;
+    for (uint8_t i = 0; i < CONNECTION_TABLE_SIZE; i++) {
+        peers[i].handle = CONNECTION_HANDLE_INVALID;
+    }
+    return SL_STATUS_OK;
+}
+
+void sample_batch_push(sensor_id_t sensor, uint16_t value) {
+    if (!connection_table_any_subscribed(gattdb_batched_samples)) {
+        return;
+    }
+    sync_peers();
+    update_count();
+    if (count == SAMPLE_BATCH_RING_SIZE) {
+        count--;        // overwrite the oldest sample
+        dropped++;
+    }
+    ring[head].timestamp_ms = app_clock_ms();
+    ring[head].value = value;
+    ring[head].sensor = (uint8_t)sensor;
+    head = (head + 1) % SAMPLE_BATCH_RING_SIZE;
+    written++;
+    count++;
+
+    if (count == 1) {
+        arm_latency_deadline();
+    }
+    // Full notifications go out right away; the rest waits for the
+    // latency deadline.
+    if (count >= records_per_packet(connection_table_min_mtu(gattdb_batched_samples))) {
+        send_pending(UINT32_MAX);
+    }
+}
+
+uint32_t sample_batch_flush(void) {
+    uint32_t most_sent;
+
+    app_scheduler_cancel(flush_job);
+    sync_peers();
+    most_sent = send_pending(1);
+    if (count > 0 && !retry_armed) {
+        arm_latency_deadline();
+    }
+    return most_sent;
+}
+
+uint32_t sample_batch_pending(void) {
+    return count;
+}
+
+uint32_t sample_batch_dropped(void) {
+    return dropped;
+}
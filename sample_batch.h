@@ -0,0 +1,37 @@
+#ifndef SAMPLE_BATCH_H
+#define SAMPLE_BATCH_H
+
+#include <stdint.h>
+#include <sl_status.h>
+#include "sensor_scheduler.h"
+#include "app_scheduler.h"
+
+// Batched Samples notification layout (little-endian):
+//   uint16 sequence     incremented per notification to this peer,
+//                       from 0 when it subscribes
+//   uint32 base_ms      timestamp of the first record, ms since boot
+//   records[]           uint8 sensor id, uint16 ms since previous record,
+//                       uint16 value in the sensor characteristic's format
+#define SAMPLE_BATCH_HEADER_SIZE    6
+#define SAMPLE_BATCH_RECORD_SIZE    5
+#define SAMPLE_BATCH_MAX_PAYLOAD    244     // 247-byte ATT MTU minus 3
+
+// flush_job is posted when the latency deadline of a partially filled
+// batch expires; its handler calls sample_batch_flush().
+sl_status_t sample_batch_init(app_job_t *flush_job);
+
+// Buffer one sample if a peer subscribes to Batched Samples. A full
+// MTU-sized batch is sent right away.
+void sample_batch_push(sensor_id_t sensor, uint16_t value);
+
+// Send each subscriber the buffered samples it has not received, packed
+// into notifications sized for its MTU. A peer whose notification is
+// refused keeps its samples and is retried after SAMPLE_BATCH_RETRY_MS
+// without holding back the others. Returns the most notifications sent
+// to any one peer.
+uint32_t sample_batch_flush(void);
+
+uint32_t sample_batch_pending(void);
+uint32_t sample_batch_dropped(void);
+
+#endif // SAMPLE_BATCH_H
@@ -0,0 +1,195 @@
+#include <string.h>
+#include "em_core.h"
+#include "app_clock.h"
+#include "sensor_filter.h"
+#include "sensor_filter_config.h"
+#define LOG_MODULE SENSOR
+#include "log_module.h"
+
+#if SENSOR_FILTER_TEMPERATURE_WINDOW > SENSOR_FILTER_MAX_WINDOW \
+    || SENSOR_FILTER_HUMIDITY_WINDOW > SENSOR_FILTER_MAX_WINDOW \
+    || SENSOR_FILTER_IRRADIANCE_WINDOW > SENSOR_FILTER_MAX_WINDOW
+#error "Sensor filter windows must not exceed SENSOR_FILTER_MAX_WINDOW"
+#endif
+
+// EMA state keeps this many fraction bits, so small steps still move it.
+#define EMA_FRACTION_BITS  8
+
+typedef struct {
+    uint8_t type;
+    uint8_t window;
+    uint8_t ema_shift;
+    uint16_t deadband;
+    uint32_t max_silence_ms;
+} filter_config_t;
+
+static const filter_config_t configs[SENSOR_ID_COUNT] = {
+    [SENSOR_ID_TEMPERATURE] = {
+        SENSOR_FILTER_TEMPERATURE_TYPE,
+        SENSOR_FILTER_TEMPERATURE_WINDOW,
+        SENSOR_FILTER_TEMPERATURE_EMA_SHIFT,
+        SENSOR_FILTER_TEMPERATURE_DEADBAND,
+        SENSOR_FILTER_TEMPERATURE_MAX_SILENCE_MS,
+    },
+    [SENSOR_ID_HUMIDITY] = {
+        SENSOR_FILTER_HUMIDITY_TYPE,
+        SENSOR_FILTER_HUMIDITY_WINDOW,
+        SENSOR_FILTER_HUMIDITY_EMA_SHIFT,
+        SENSOR_FILTER_HUMIDITY_DEADBAND,
+        SENSOR_FILTER_HUMIDITY_MAX_SILENCE_MS,
+    },
+    [SENSOR_ID_IRRADIANCE] = {
+        SENSOR_FILTER_IRRADIANCE_TYPE,
+        SENSOR_FILTER_IRRADIANCE_WINDOW,
+        SENSOR_FILTER_IRRADIANCE_EMA_SHIFT,
+        SENSOR_FILTER_IRRADIANCE_DEADBAND,
+        SENSOR_FILTER_IRRADIANCE_MAX_SILENCE_MS,
+    },
+};
+
+typedef struct {
+    int32_t window[SENSOR_FILTER_MAX_WINDOW];   // ring of the latest readings
+    uint8_t count;
+    uint8_t next;
+    int32_t sum;                 // of the readings in window[]
+    int32_t ema;                 // Q EMA_FRACTION_BITS
+    int32_t output;              // last filtered value
+    int32_t reference;           // last notified value
+    uint32_t reference_ms;
+    bool has_reference;
+    sensor_filter_stats_t stats;
+} filter_state_t;
+
+static filter_state_t states[SENSOR_ID_COUNT];
+
+static int32_t divide_rounded(int32_t value, int32_t divisor) {
+    return (value >= 0) ? (value + divisor / 2) / divisor : (value - divisor / 2) / divisor;
+}
+
+static int32_t median(const filter_state_t *state) {
+    int32_t sorted[SENSOR_FILTER_MAX_WINDOW];
+
+    // Insertion sort: at most 16 entries.
+    for (uint8_t i = 0; i < state->count; i++) {
+        int32_t v = state->window[i];
+        uint8_t j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+    if (state->count & 1) {
+        return sorted[state->count / 2];
+    }
+    return divide_rounded(sorted[state->count / 2 - 1] + sorted[state->count / 2], 2);
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+void sensor_filter_init(void) {
+    memset(states, 0, sizeof(states));
+}
+
+int32_t sensor_filter_apply(sensor_id_t id, int32_t value) {
+    const filter_config_t *config = &configs[id];
+    filter_state_t *state = &states[id];
+
+    state->stats.samples++;
+    switch (config->type) {
+    case SENSOR_FILTER_MOVING_AVERAGE:
+    case SENSOR_FILTER_MEDIAN:
+        if (state->count == config->window) {
+            state->sum -= state->window[state->next];
+        } else {
+            state->count++;
+        }
+        state->window[state->next] = value;
+        state->sum += value;
+        state->next = (uint8_t)((state->next + 1) % config->window);
+        state->output = (config->type == SENSOR_FILTER_MEDIAN)
+                        ? median(state)
+                        : divide_rounded(state->sum, state->count);
+        break;
+
+    case SENSOR_FILTER_EMA:
+        if (state->count == 0) {
+            // Start from the first reading instead of ramping up from 0.
+            state->ema = value * (1 << EMA_FRACTION_BITS);
+            state->count = 1;
+        } else {
+            state->ema += (value * (1 << EMA_FRACTION_BITS) - state->ema) / (1 << config->ema_shift);
+        }
+        state->output = divide_rounded(state->ema, 1 << EMA_FRACTION_BITS);
+        break;
+
+    default:
+        state->output = value;
+        break;
+    }
+    return state->output;
+}
+
+bool sensor_filter_should_notify(sensor_id_t id) {
+    const filter_config_t *config = &configs[id];
+    filter_state_t *state = &states[id];
+    uint32_t now = app_clock_ms();
+    bool moved;
+    bool silent;
+
+    if (!state->has_reference) {
+        moved = true;
+        silent = false;
+    } else {
+        int32_t delta = state->output - state->reference;
+        moved = (delta < 0 ? -delta : delta) > (int32_t)config->deadband
+                || config->deadband == 0;
+        silent = config->max_silence_ms != 0
+                 && (now - state->reference_ms) >= config->max_silence_ms;
+    }
+    if (!moved && !silent) {
+        state->stats.suppressed++;
+        return false;
+    }
+    if (!moved) {
+        state->stats.heartbeats++;
+    }
+    state->stats.notified++;
+    state->reference = state->output;
+    state->reference_ms = now;
+    state->has_reference = true;
+    return true;
+}
+
+void sensor_filter_notify_next(sensor_id_t id) {
+    states[id].has_reference = false;
+}
+
+void sensor_filter_get_stats(sensor_id_t id, sensor_filter_stats_t *out) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    *out = states[id].stats;
+    CORE_EXIT_ATOMIC();
+}
+
+void sensor_filter_log(void) {
+    static const char *const names[SENSOR_ID_COUNT] = {
+        [SENSOR_ID_TEMPERATURE] = "temperature",
+        [SENSOR_ID_HUMIDITY] = "humidity",
+        [SENSOR_ID_IRRADIANCE] = "irradiance",
+    };
+
+    for (int id = 0; id < SENSOR_ID_COUNT; id++) {
+        sensor_filter_stats_t stats;
+
+        sensor_filter_get_stats((sensor_id_t)id, &stats);
+        LOG_INFO("Filter %s: %lu samples, %lu notified (%lu heartbeats), %lu suppressed.\n",
+                 names[id],
+                 (unsigned long)stats.samples,
+                 (unsigned long)stats.notified,
+                 (unsigned long)stats.heartbeats,
+                 (unsigned long)stats.suppressed);
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef SENSOR_FILTER_H
+#define SENSOR_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sensor_scheduler.h"
+
+#define SENSOR_FILTER_NONE              0
+#define SENSOR_FILTER_MOVING_AVERAGE    1
+#define SENSOR_FILTER_EMA               2
+#define SENSOR_FILTER_MEDIAN            3
+
+#define SENSOR_FILTER_MAX_WINDOW        16
+
+typedef struct {
+    uint32_t samples;            // readings filtered
+    uint32_t notified;           // notifications let through
+    uint32_t suppressed;         // samples inside the deadband
+    uint32_t heartbeats;         // notifications sent only for the silence limit
+} sensor_filter_stats_t;
+
+void sensor_filter_init(void);
+
+// Feed one reading, in the characteristic's wire units, through the
+// sensor's configured filter. Returns the filtered value. Integer only.
+int32_t sensor_filter_apply(sensor_id_t id, int32_t value);
+
+// True if the last filtered value should be notified: it left the deadband
+// around the last notified value, the maximum silence expired, or a peer
+// subscribed since. A true answer makes it the new reference.
+bool sensor_filter_should_notify(sensor_id_t id);
+
+// Let the next sample through regardless of the deadband, so a new
+// subscriber gets a value at the next sample.
+void sensor_filter_notify_next(sensor_id_t id);
+
+void sensor_filter_get_stats(sensor_id_t id, sensor_filter_stats_t *out);
+void sensor_filter_log(void);
+
+#endif // SENSOR_FILTER_H
@@ -0,0 +1,172 @@
+#include <stddef.h>
+#include "em_core.h"
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#include "sensor_scheduler.h"
+#include "sensor_scheduler_config.h"
+
+// Deadlines are absolute 32-bit ticks compared with wrap-safe signed
+// differences, which holds for periods up to 2^31 ticks (65536 s at the
+// 32768 Hz sleeptimer clock), covering the whole Measurement Interval range.
+typedef struct {
+    uint32_t period_ticks;
+    uint32_t next_due;       // absolute sleeptimer tick
+} sensor_slot_t;
+
+static sensor_slot_t slots[SENSOR_ID_COUNT];
+static uint32_t subscribed_mask = 0;
+static volatile uint32_t due_mask = 0;
+static uint32_t due_signal = 0;
+static uint32_t coalesce_ticks = 0;
+static sl_sleeptimer_timer_handle_t scheduler_timer;
+
+static void scheduler_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data);
+
+static uint32_t ms_to_ticks(uint32_t ms) {
+    uint32_t ticks = 0;
+    if (sl_sleeptimer_ms32_to_tick(ms, &ticks) != SL_STATUS_OK || ticks == 0) {
+        ticks = 1;
+    }
+    return ticks;
+}
+
+/**************************************************************************/
+/* Rearm the single timer on the earliest subscribed deadline.            */
+/* Must be called with interrupts masked.                                 */
+/**************************************************************************/
+static void rearm(void) {
+    uint32_t now = sl_sleeptimer_get_tick_count();
+    uint32_t delay = UINT32_MAX;
+
+    sl_sleeptimer_stop_timer(&scheduler_timer);
+    if (subscribed_mask == 0) {
+        return;
+    }
+    for (int id = 0; id < SENSOR_ID_COUNT; id++) {
+        if (subscribed_mask & SENSOR_MASK(id)) {
+            int32_t remaining = (int32_t)(slots[id].next_due - now);
+            uint32_t d = (remaining > 0) ? (uint32_t)remaining : 1;
+            if (d < delay) {
+                delay = d;
+            }
+        }
+    }
+    sl_sleeptimer_start_timer(&scheduler_timer,
+                              delay,
+                              scheduler_timer_callback,
+                              NULL,
+                              0,
+                              0);
+}
+
+/**************************************************************************/
+/* Timer Callback                                                         */
+/**************************************************************************/
+static void scheduler_timer_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+    (void)handle;
+    (void)data;
+    uint32_t now = sl_sleeptimer_get_tick_count();
+    uint32_t due = 0;
+
+    // Everything due now or within the coalescing window shares this wake-up.
+    for (int id = 0; id < SENSOR_ID_COUNT; id++) {
+        if ((subscribed_mask & SENSOR_MASK(id))
+            && (int32_t)(slots[id].next_due - now) <= (int32_t)coalesce_ticks) {
+            due |= SENSOR_MASK(id);
+            // Advance from the deadline, not from now, so callback latency
+            // never accumulates into drift. Missed periods are skipped.
+            slots[id].next_due += slots[id].period_ticks;
+            if ((int32_t)(slots[id].next_due - now) <= 0) {
+                uint32_t late = now - slots[id].next_due;
+                slots[id].next_due += (late / slots[id].period_ticks + 1) * slots[id].period_ticks;
+            }
+        }
+    }
+    rearm();
+
+    if (due != 0) {
+        due_mask |= due;
+        sl_bt_external_signal(due_signal);
+    }
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+sl_status_t sensor_scheduler_init(uint32_t signal) {
+    due_signal = signal;
+    coalesce_ticks = (SENSOR_SCHEDULER_COALESCE_MS > 0)
+                     ? ms_to_ticks(SENSOR_SCHEDULER_COALESCE_MS) : 0;
+    slots[SENSOR_ID_TEMPERATURE].period_ticks = ms_to_ticks(SENSOR_SCHEDULER_TEMPERATURE_PERIOD_MS);
+    slots[SENSOR_ID_HUMIDITY].period_ticks = ms_to_ticks(SENSOR_SCHEDULER_HUMIDITY_PERIOD_MS);
+    slots[SENSOR_ID_IRRADIANCE].period_ticks = ms_to_ticks(SENSOR_SCHEDULER_IRRADIANCE_PERIOD_MS);
+    subscribed_mask = 0;
+    due_mask = 0;
+    return SL_STATUS_OK;
+}
+
+void sensor_scheduler_set_period_ms(sensor_id_t id, uint32_t period_ms) {
+    CORE_DECLARE_IRQ_STATE;
+
+    if (id >= SENSOR_ID_COUNT) {
+        return;
+    }
+    CORE_ENTER_ATOMIC();
+    uint32_t old_period = slots[id].period_ticks;
+    slots[id].period_ticks = ms_to_ticks(period_ms);
+    if ((subscribed_mask & SENSOR_MASK(id)) && slots[id].period_ticks != old_period) {
+        // Keep the phase: the next deadline is one new period after the
+        // last one. If that is already behind us, sample right away.
+        uint32_t now = sl_sleeptimer_get_tick_count();
+        slots[id].next_due = slots[id].next_due - old_period + slots[id].period_ticks;
+        if ((int32_t)(slots[id].next_due - now) < 0) {
+            slots[id].next_due = now;
+        }
+        rearm();
+    }
+    CORE_EXIT_ATOMIC();
+}
+
+void sensor_scheduler_set_subscribed(sensor_id_t id, bool subscribed) {
+    CORE_DECLARE_IRQ_STATE;
+
+    if (id >= SENSOR_ID_COUNT) {
+        return;
+    }
+    CORE_ENTER_ATOMIC();
+    bool was_subscribed = (subscribed_mask & SENSOR_MASK(id)) != 0;
+    if (subscribed && !was_subscribed) {
+        // Join the phase of an already running sensor with the same period,
+        // so both are served by one wake-up instead of two.
+        uint32_t next_due = sl_sleeptimer_get_tick_count() + slots[id].period_ticks;
+        for (int other = 0; other < SENSOR_ID_COUNT; other++) {
+            if ((subscribed_mask & SENSOR_MASK(other))
+                && slots[other].period_ticks == slots[id].period_ticks) {
+                next_due = slots[other].next_due;
+                break;
+            }
+        }
+        slots[id].next_due = next_due;
+        subscribed_mask |= SENSOR_MASK(id);
+        rearm();
+    } else if (!subscribed && was_subscribed) {
+        subscribed_mask &= ~SENSOR_MASK(id);
+        due_mask &= ~SENSOR_MASK(id);
+        rearm();
+    }
+    CORE_EXIT_ATOMIC();
+}
+
+uint32_t sensor_scheduler_get_subscribed(void) {
+    return subscribed_mask;
+}
+
+uint32_t sensor_scheduler_take_due(void) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    uint32_t due = due_mask;
+    due_mask = 0;
+    CORE_EXIT_ATOMIC();
+    return due;
+}
@@ -0,0 +1,34 @@
+#ifndef SENSOR_SCHEDULER_H
+#define SENSOR_SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sl_status.h>
+
+typedef enum {
+    SENSOR_ID_TEMPERATURE,
+    SENSOR_ID_HUMIDITY,
+    SENSOR_ID_IRRADIANCE,
+    SENSOR_ID_COUNT
+} sensor_id_t;
+
+#define SENSOR_MASK(id) (1UL << (id))
+
+// Initialise the scheduler. due_signal is posted through
+// sl_bt_external_signal() whenever at least one sensor falls due.
+sl_status_t sensor_scheduler_init(uint32_t due_signal);
+
+// Change the sampling period of one sensor.
+void sensor_scheduler_set_period_ms(sensor_id_t id, uint32_t period_ms);
+
+// Mark a sensor as wanted (or not) by at least one client. Sensors nobody
+// subscribes to are never scheduled; the timer stops when the mask is empty.
+void sensor_scheduler_set_subscribed(sensor_id_t id, bool subscribed);
+
+// Mask of currently subscribed sensors.
+uint32_t sensor_scheduler_get_subscribed(void);
+
+// Return and clear the mask of sensors that fell due since the last call.
+uint32_t sensor_scheduler_take_due(void);
+
+#endif // SENSOR_SCHEDULER_H
@@ -0,0 +1,77 @@
+#include "app_clock.h"
+#include "sensor_values.h"
+#include "sensor_filter.h"
+#include "sensor_values_config.h"
+#define LOG_MODULE SENSOR
+#include "log_module.h"
+
+// Irradiance (2A77) is reported in 0.1 W/m2. Lux are converted with the
+// 683 lm/W luminous efficacy of the lumen definition.
+#define LUX_PER_W_PER_M2         683.0f
+
+#define TEMPERATURE_UNKNOWN      0x8000
+#define HUMIDITY_UNKNOWN         0xFFFF
+#define HUMIDITY_MAX             10000      // 100.00 %
+
+static uint8_t values[SENSOR_ID_COUNT][SENSOR_VALUE_SIZE] = {
+    [SENSOR_ID_TEMPERATURE] = { TEMPERATURE_UNKNOWN & 0xFF, TEMPERATURE_UNKNOWN >> 8 },
+    [SENSOR_ID_HUMIDITY] = { HUMIDITY_UNKNOWN & 0xFF, HUMIDITY_UNKNOWN >> 8 },
+};
+
+static uint32_t updated_ms[SENSOR_ID_COUNT];
+static uint32_t known_mask = 0;
+
+// The filter sees readings already saturated to the wire range, so its
+// averages stay inside it too. It only sees the scheduled series: a
+// sample taken off-schedule for a stale read would skew its window and
+// timing, so that one is cached as read.
+static uint16_t store(sensor_id_t id, int32_t reading, bool scheduled) {
+    uint16_t value = scheduled ? (uint16_t)sensor_filter_apply(id, reading) : (uint16_t)reading;
+
+    values[id][0] = value & 0xFF;
+    values[id][1] = (value >> 8) & 0xFF;
+    updated_ms[id] = app_clock_ms();
+    known_mask |= SENSOR_MASK(id);
+    return value;
+}
+
+uint16_t sensor_value_set_temperature(int32_t milli_celsius, bool scheduled) {
+    int32_t centi_celsius = milli_celsius / 10;
+
+    // 0x8000 is reserved for "unknown".
+    if (centi_celsius < INT16_MIN + 1 || centi_celsius > INT16_MAX) {
+        LOG_DEBUG("Temperature %ld mdegC out of range.\n", milli_celsius);
+        centi_celsius = (centi_celsius < 0) ? INT16_MIN + 1 : INT16_MAX;
+    }
+    return store(SENSOR_ID_TEMPERATURE, centi_celsius, scheduled);
+}
+
+uint16_t sensor_value_set_humidity(uint32_t milli_percent, bool scheduled) {
+    uint32_t centi_percent = milli_percent / 10;
+
+    if (centi_percent > HUMIDITY_MAX) {
+        LOG_DEBUG("Humidity %lu m%% out of range.\n", milli_percent);
+        centi_percent = HUMIDITY_MAX;
+    }
+    return store(SENSOR_ID_HUMIDITY, (int32_t)centi_percent, scheduled);
+}
+
+uint16_t sensor_value_set_irradiance(float lux, bool scheduled) {
+    float deci_w_per_m2 = (lux * 10.0f) / LUX_PER_W_PER_M2;
+
+    if (deci_w_per_m2 < 0.0f) {
+        deci_w_per_m2 = 0.0f;
+    } else if (deci_w_per_m2 > (float)UINT16_MAX) {
+        deci_w_per_m2 = (float)UINT16_MAX;
+    }
+    return store(SENSOR_ID_IRRADIANCE, (int32_t)deci_w_per_m2, scheduled);
+}
+
+const uint8_t *sensor_value_get(sensor_id_t id) {
+    return values[id];
+}
+
+bool sensor_value_is_fresh(sensor_id_t id) {
+    return (known_mask & SENSOR_MASK(id))
+           && (app_clock_ms() - updated_ms[id]) <= SENSOR_VALUES_MAX_AGE_MS;
+}
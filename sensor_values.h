@@ -0,0 +1,32 @@
+#ifndef SENSOR_VALUES_H
+#define SENSOR_VALUES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sensor_scheduler.h"
+
+// Every Environmental Sensing value used here is 16 bits, little-endian.
+#define SENSOR_VALUE_SIZE 2
+
+// Encode a reading straight into the characteristic's wire format, in the
+// buffer that notifications and read responses are both sent from:
+//   Temperature (2A6E) sint16, 0.01 degC, from milli-degrees Celsius
+//   Humidity    (2A6F) uint16, 0.01 %,    from milli-percent
+//   Irradiance  (2A77) uint16, 0.1 W/m2,  from lux
+// Out-of-range readings saturate. A scheduled sample then passes the
+// sensor's filter (see sensor_filter.h) and the filtered value is cached;
+// one taken off-schedule to answer a stale read is cached unfiltered and
+// leaves the filter alone. Each returns the encoded value for the other
+// consumers (batch, broadcasts, history, log).
+uint16_t sensor_value_set_temperature(int32_t milli_celsius, bool scheduled);
+uint16_t sensor_value_set_humidity(uint32_t milli_percent, bool scheduled);
+uint16_t sensor_value_set_irradiance(float lux, bool scheduled);
+
+// SENSOR_VALUE_SIZE bytes in wire format. Until the first reading this is
+// the characteristic's "unknown" value where it defines one, else 0.
+const uint8_t *sensor_value_get(sensor_id_t id);
+
+// True once the sensor has a value no older than SENSOR_VALUES_MAX_AGE_MS.
+bool sensor_value_is_fresh(sensor_id_t id);
+
+#endif // SENSOR_VALUES_H
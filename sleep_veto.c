@@ -0,0 +1,168 @@
+#include <stdbool.h>
+#include <string.h>
+#include "em_core.h"
+#include "sl_power_manager.h"
+#include "sl_sleeptimer.h"
+#include "app_timer.h"
+#include "sl_bluetooth.h"
+#include "sl_iostream_init_usart_instances.h"
+#include "app_scheduler.h"
+#define LOG_MODULE DIAGNOSTICS
+#include "log_module.h"
+#include "sleep_veto.h"
+#include "sleep_veto_config.h"
+
+#if SLEEP_VETO_ENABLE
+
+#if (SLEEP_VETO_RECORDS & (SLEEP_VETO_RECORDS - 1)) != 0
+#error "SLEEP_VETO_RECORDS must be a power of two"
+#endif
+
+static const char *const source_names[SLEEP_VETO_SOURCE_COUNT] = {
+    "app_timer", "bt", "vcom", "scheduler"
+};
+
+static sleep_veto_counters_t counters;
+static sleep_veto_record_t records[SLEEP_VETO_RECORDS];
+static uint32_t record_head = 0;   // total records written
+
+// Both hooks run with interrupts masked or from ISR context.
+static void record(sleep_veto_source_t source, sleep_veto_kind_t kind) {
+    sleep_veto_record_t *r = &records[record_head & (SLEEP_VETO_RECORDS - 1)];
+    r->tick = sl_sleeptimer_get_tick_count();
+    r->source = (uint8_t)source;
+    r->kind = (uint8_t)kind;
+    record_head++;
+}
+
+static void tally(sleep_veto_source_t source, sl_power_manager_on_isr_exit_t answer,
+                  bool *sleep, bool *wakeup) {
+    if (answer == SL_POWER_MANAGER_WAKEUP) {
+        counters.wakeups[source]++;
+        record(source, SLEEP_VETO_WAKEUP);
+        *wakeup = true;
+    } else if (answer == SL_POWER_MANAGER_SLEEP) {
+        counters.sleeps[source]++;
+        *sleep = true;
+    }
+}
+
+/**************************************************************************/
+/* Power Manager Application Hooks                                        */
+/**************************************************************************/
+bool app_is_ok_to_sleep(void) {
+    bool ok = app_scheduler_is_ok_to_sleep();
+
+    counters.sleep_checks++;
+    if (!sli_app_timer_is_ok_to_sleep()) {
+        counters.denied[SLEEP_VETO_SOURCE_APP_TIMER]++;
+        record(SLEEP_VETO_SOURCE_APP_TIMER, SLEEP_VETO_DENIED);
+    }
+    if (!sli_bt_is_ok_to_sleep()) {
+        counters.denied[SLEEP_VETO_SOURCE_BT]++;
+        record(SLEEP_VETO_SOURCE_BT, SLEEP_VETO_DENIED);
+    }
+    if (!ok) {
+        counters.denied[SLEEP_VETO_SOURCE_SCHEDULER]++;
+        record(SLEEP_VETO_SOURCE_SCHEDULER, SLEEP_VETO_DENIED);
+    }
+    return ok;
+}
+
+sl_power_manager_on_isr_exit_t app_sleep_on_isr_exit(void) {
+    bool sleep = sl_power_manager_is_latest_wakeup_internal();
+    bool wakeup = false;
+    sl_power_manager_on_isr_exit_t answer = app_scheduler_sleep_on_isr_exit();
+
+    counters.isr_exits++;
+    tally(SLEEP_VETO_SOURCE_APP_TIMER, sli_app_timer_sleep_on_isr_exit(), &sleep, &wakeup);
+    tally(SLEEP_VETO_SOURCE_BT, sli_bt_sleep_on_isr_exit(), &sleep, &wakeup);
+    tally(SLEEP_VETO_SOURCE_VCOM, sl_iostream_usart_vcom_sleep_on_isr_exit(), &sleep, &wakeup);
+    tally(SLEEP_VETO_SOURCE_SCHEDULER, answer, &sleep, &wakeup);
+    // Nobody asked to go back to sleep, so the power manager stays in EM0
+    // without any module having claimed the interrupt.
+    if (!sleep && !wakeup) {
+        counters.unclaimed++;
+        record(SLEEP_VETO_SOURCE_NONE, SLEEP_VETO_UNCLAIMED);
+    }
+    return answer;
+}
+
+/**************************************************************************/
+/* Public API                                                             */
+/**************************************************************************/
+void sleep_veto_get_counters(sleep_veto_counters_t *out) {
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    *out = counters;
+    CORE_EXIT_ATOMIC();
+}
+
+size_t sleep_veto_get_records(sleep_veto_record_t *out, size_t max) {
+    CORE_DECLARE_IRQ_STATE;
+    size_t count;
+
+    CORE_ENTER_ATOMIC();
+    count = (record_head < SLEEP_VETO_RECORDS) ? record_head : SLEEP_VETO_RECORDS;
+    if (count > max) {
+        count = max;
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i] = records[(record_head - count + i) & (SLEEP_VETO_RECORDS - 1)];
+    }
+    CORE_EXIT_ATOMIC();
+    return count;
+}
+
+void sleep_veto_log(void) {
+    sleep_veto_counters_t c;
+    sleep_veto_record_t last[4];
+    size_t count;
+
+    sleep_veto_get_counters(&c);
+    LOG_INFO("Sleep checks %lu, ISR exits %lu, unclaimed wake-ups %lu.\n",
+             (unsigned long)c.sleep_checks,
+             (unsigned long)c.isr_exits,
+             (unsigned long)c.unclaimed);
+    for (int source = 0; source < SLEEP_VETO_SOURCE_COUNT; source++) {
+        LOG_INFO("  %s: denied %lu, woke %lu, slept %lu\n",
+                 source_names[source],
+                 (unsigned long)c.denied[source],
+                 (unsigned long)c.wakeups[source],
+                 (unsigned long)c.sleeps[source]);
+    }
+    count = sleep_veto_get_records(last, sizeof(last) / sizeof(last[0]));
+    for (size_t i = 0; i < count; i++) {
+        LOG_INFO("  veto at tick %lu: %s %s\n",
+                 (unsigned long)last[i].tick,
+                 (last[i].source < SLEEP_VETO_SOURCE_COUNT) ? source_names[last[i].source] : "none",
+                 (last[i].kind == SLEEP_VETO_DENIED) ? "denied"
+                 : (last[i].kind == SLEEP_VETO_WAKEUP) ? "woke" : "unclaimed");
+    }
+}
+
+#else
+
+bool app_is_ok_to_sleep(void) {
+    return app_scheduler_is_ok_to_sleep();
+}
+
+sl_power_manager_on_isr_exit_t app_sleep_on_isr_exit(void) {
+    return app_scheduler_sleep_on_isr_exit();
+}
+
+void sleep_veto_get_counters(sleep_veto_counters_t *out) {
+    memset(out, 0, sizeof(*out));
+}
+
+size_t sleep_veto_get_records(sleep_veto_record_t *out, size_t max) {
+    (void)out;
+    (void)max;
+    return 0;
+}
+
+void sleep_veto_log(void) {
+}
+
+#endif // SLEEP_VETO_ENABLE
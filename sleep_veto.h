@@ -0,0 +1,53 @@
+#ifndef SLEEP_VETO_H
+#define SLEEP_VETO_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Attribution of the power manager's sleep decisions. The module provides
+// app_is_ok_to_sleep() and app_sleep_on_isr_exit(), which the generated
+// power manager handler calls after the other sources, and re-asks those
+// sources (their hooks are side-effect free) to record which one refused
+// to sleep or forced a wake-up. The application vetoes only while a
+// scheduler job is pending; the hooks keep doing that with
+// SLEEP_VETO_ENABLE at 0, recording nothing.
+
+typedef enum {
+    SLEEP_VETO_SOURCE_APP_TIMER,
+    SLEEP_VETO_SOURCE_BT,
+    SLEEP_VETO_SOURCE_VCOM,       // only asked on ISR exit
+    SLEEP_VETO_SOURCE_SCHEDULER,  // application jobs pending
+    SLEEP_VETO_SOURCE_COUNT,
+    SLEEP_VETO_SOURCE_NONE = 0xFF
+} sleep_veto_source_t;
+
+typedef enum {
+    SLEEP_VETO_DENIED,            // source said no when the MCU was about to sleep
+    SLEEP_VETO_WAKEUP,            // source forced a wake-up on ISR exit
+    SLEEP_VETO_UNCLAIMED          // ISR exit woke the MCU but no source claimed it
+} sleep_veto_kind_t;
+
+typedef struct {
+    uint32_t tick;                // sleeptimer tick
+    uint8_t source;               // sleep_veto_source_t
+    uint8_t kind;                 // sleep_veto_kind_t
+} sleep_veto_record_t;
+
+typedef struct {
+    uint32_t sleep_checks;        // calls of the is-ok-to-sleep hook
+    uint32_t isr_exits;           // calls of the sleep-on-ISR-exit hook
+    uint32_t unclaimed;           // ISR exits that woke up for no claimed reason
+    uint32_t denied[SLEEP_VETO_SOURCE_COUNT];
+    uint32_t wakeups[SLEEP_VETO_SOURCE_COUNT];
+    uint32_t sleeps[SLEEP_VETO_SOURCE_COUNT];   // asked to go back to sleep
+} sleep_veto_counters_t;
+
+void sleep_veto_get_counters(sleep_veto_counters_t *out);
+
+// Copy up to max of the most recent veto records, oldest first. Returns
+// the number copied.
+size_t sleep_veto_get_records(sleep_veto_record_t *out, size_t max);
+
+void sleep_veto_log(void);
+
+#endif // SLEEP_VETO_H
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Restore the text of a binlog VCOM capture.
+
+The firmware (binlog.c, BINLOG_ENABLE=1) writes two kinds of frames:
+
+  0xA5 id nargs tick[4] args[4*nargs] xor   binary log entry
+  0xA6 len text[len] xor                    app_log text
+
+Bytes outside a valid frame (text printed before binlog_init()) are passed
+through unchanged. Format strings and argument counts are read from
+binlog_formats.h, so the decoder always matches the tree it is run from.
+
+Usage:
+  tools/binlog_decode.py capture.bin
+  cat /dev/ttyACM0 | tools/binlog_decode.py -
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SYNC = 0xA5
+TEXT_SYNC = 0xA6
+MAX_ARGS = 3
+TEXT_CHUNK_MAX = 64
+TICK_HZ = 32768
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_FORMATS = os.path.join(HERE, "..", "binlog_formats.h")
+
+
+def load_formats(path):
+    """Return [(name, nargs, format)] in frame-ID order."""
+    with open(path) as f:
+        source = f.read()
+    texts = {}
+    for name, literal in re.findall(r'#define\s+BINLOG_FORMAT_(\w+)\s+((?:"(?:[^"\\]|\\.)*"\s*)+)', source):
+        text = "".join(re.findall(r'"((?:[^"\\]|\\.)*)"', literal))
+        texts[name] = text.encode().decode("unicode_escape")
+    table = source[source.index("#define BINLOG_FORMATS(X)"):]
+    formats = []
+    for name, nargs in re.findall(r'X\(\s*(\w+)\s*,\s*(\d+)\s*\)', table):
+        formats.append((name, int(nargs), texts[name]))
+    return formats
+
+
+def render(fmt, args):
+    """printf-style rendering of 32-bit arguments."""
+    values = []
+    for conv in re.findall(r'%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l)?([diuxXcs%])', fmt):
+        if conv == "%":
+            continue
+        value = args[len(values)] if len(values) < len(args) else 0
+        if conv in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+        values.append(value)
+    fmt = re.sub(r'%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l)?u', r'%\1d', fmt)
+    return fmt % tuple(values)
+
+
+def xor(data):
+    check = 0
+    for byte in data:
+        check ^= byte
+    return check
+
+
+class Decoder:
+    def __init__(self, formats, tick_hz=TICK_HZ):
+        self.formats = formats
+        self.tick_hz = tick_hz
+        self.buf = bytearray()
+        self.bad_frames = 0
+
+    def _frame_length(self):
+        """Length of the frame at buf[0], 0 if not a frame, None if short."""
+        sync = self.buf[0]
+        if sync == SYNC:
+            if len(self.buf) < 3:
+                return None
+            ident, nargs = self.buf[1], self.buf[2]
+            if ident >= len(self.formats) or nargs > MAX_ARGS:
+                return 0
+            return 3 + 4 + 4 * nargs + 1
+        if sync == TEXT_SYNC:
+            if len(self.buf) < 2:
+                return None
+            if not 0 < self.buf[1] <= TEXT_CHUNK_MAX:
+                return 0
+            return 2 + self.buf[1] + 1
+        return 0
+
+    def feed(self, data):
+        """Consume bytes, return decoded text."""
+        out = []
+        self.buf.extend(data)
+        while self.buf:
+            length = self._frame_length()
+            if length is None or (length and len(self.buf) < length):
+                break
+            frame = bytes(self.buf[:length]) if length else b""
+            if not length or xor(frame[1:-1]) != frame[-1]:
+                # Not a frame: raw text, or a frame cut by a dropped byte.
+                if length:
+                    self.bad_frames += 1
+                out.append(chr(self.buf[0]))
+                del self.buf[0]
+                continue
+            del self.buf[:length]
+            if frame[0] == TEXT_SYNC:
+                out.append(frame[2:-1].decode("latin-1"))
+                continue
+            name, nargs, fmt = self.formats[frame[1]]
+            tick = int.from_bytes(frame[3:7], "little")
+            args = [int.from_bytes(frame[7 + 4 * i:11 + 4 * i], "little") for i in range(frame[2])]
+            if frame[2] != nargs:
+                out.append("[%10.3f] %s: %d args, expected %d\n" % (tick / self.tick_hz, name, frame[2], nargs))
+                continue
+            out.append("[%10.3f] %s" % (tick / self.tick_hz, render(fmt, args)))
+        return "".join(out)
+
+    def flush(self):
+        text = self.buf.decode("latin-1")
+        self.buf.clear()
+        return text
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("capture", help="raw VCOM capture, - for stdin")
+    parser.add_argument("--formats", default=DEFAULT_FORMATS, help="path to binlog_formats.h")
+    parser.add_argument("--tick-hz", type=int, default=TICK_HZ, help="sleeptimer frequency")
+    args = parser.parse_args()
+
+    decoder = Decoder(load_formats(args.formats), args.tick_hz)
+    stream = sys.stdin.buffer if args.capture == "-" else open(args.capture, "rb")
+    with stream:
+        while True:
+            data = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+            if not data:
+                break
+            sys.stdout.write(decoder.feed(data))
+            sys.stdout.flush()
+    sys.stdout.write(decoder.flush())
+    if decoder.bad_frames:
+        print("binlog_decode: %d frames failed the checksum" % decoder.bad_frames, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
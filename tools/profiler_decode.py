@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+"""Per-zone timing histograms from a profiler SWO capture.
+
+The firmware (profiler.c, PROFILER_ENABLE=1) writes one 32-bit word per
+zone edge to ITM stimulus port PROFILER_ITM_CHANNEL:
+
+  bits 31..25  zone      bit 24  1 = begin, 0 = end
+  bits 23..0   DWT cycle counter, low 24 bits
+
+The capture is the raw SWO byte stream (ITM packets, UART encoding at the
+rate set in sl_debug_swo_config.h). Packets from other ports, timestamps
+and sync packets are skipped. With --words the input is the port's data
+alone, as 32-bit little-endian words.
+
+A zone's duration is (end - begin) mod 2^24 cycles. Nested zones count in
+their parent's time too: RHT_RESULT includes the NOTIFY and LOG zones run
+inside it. Zone names are read from profiler.h and the ITM port from
+profiler_config.h, so the decoder always matches the tree it is run from.
+
+Usage:
+  tools/profiler_decode.py swo.bin
+  tools/profiler_decode.py --clock-hz 19000000 swo.bin
+"""
+
+import argparse
+import os
+import re
+import sys
+
+TIMESTAMP_BITS = 24
+TIMESTAMP_MASK = (1 << TIMESTAMP_BITS) - 1
+CLOCK_HZ = 38400000
+BAR_WIDTH = 40
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_HEADER = os.path.join(HERE, "..", "profiler.h")
+DEFAULT_CONFIG = os.path.join(HERE, "..", "config", "profiler_config.h")
+
+
+def load_zones(path):
+    """Return zone names in profiler_zone_t order."""
+    with open(path) as f:
+        source = f.read()
+    body = re.search(r'typedef enum\s*{(.*?)}\s*profiler_zone_t', source, re.S).group(1)
+    names = re.findall(r'PROFILER_ZONE_(\w+)', body)
+    return [name for name in names if name != "COUNT"]
+
+
+def load_port(path):
+    with open(path) as f:
+        return int(re.search(r'#define\s+PROFILER_ITM_CHANNEL\s+(\d+)', f.read()).group(1))
+
+
+class ItmParser:
+    """Split an SWO stream into the 32-bit writes to one stimulus port."""
+
+    def __init__(self, port):
+        self.port = port
+        self.buf = bytearray()
+        self.overflows = 0
+
+    def feed(self, data):
+        words = []
+        self.buf.extend(data)
+        i = 0
+        while i < len(self.buf):
+            header = self.buf[i]
+            if header == 0x00 or header == 0x80:
+                # Synchronization packet bytes.
+                i += 1
+                continue
+            if header == 0x70:
+                self.overflows += 1
+                i += 1
+                continue
+            if (header & 0x03) == 0:
+                # Timestamp or extension: continuation bit on each byte.
+                end = i
+                while end < len(self.buf) and self.buf[end] & 0x80:
+                    end += 1
+                if end == len(self.buf):
+                    break
+                i = end + 1
+                continue
+            size = (1, 2, 4)[(header & 0x03) - 1]
+            if i + 1 + size > len(self.buf):
+                break
+            if not header & 0x04 and header >> 3 == self.port and size == 4:
+                words.append(int.from_bytes(self.buf[i + 1:i + 5], "little"))
+            i += 1 + size
+        del self.buf[:i]
+        return words
+
+
+class Profile:
+    def __init__(self, zones):
+        self.zones = zones
+        self.open = {}
+        self.cycles = [[] for _ in zones]
+        self.unmatched = 0
+        self.unknown = 0
+
+    def feed(self, words):
+        for word in words:
+            zone = word >> 25
+            stamp = word & TIMESTAMP_MASK
+            if zone >= len(self.zones):
+                self.unknown += 1
+                continue
+            if word & (1 << 24):
+                if zone in self.open:
+                    # The end was dropped by a full ITM FIFO.
+                    self.unmatched += 1
+                self.open[zone] = stamp
+            elif zone in self.open:
+                self.cycles[zone].append((stamp - self.open.pop(zone)) & TIMESTAMP_MASK)
+            else:
+                self.unmatched += 1
+
+
+def percentile(ordered, fraction):
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def report(profile, clock_hz, out):
+    us = 1e6 / clock_hz
+    total = sum(sum(c) for c in profile.cycles) or 1
+    out.write("%-12s %7s %9s %9s %9s %9s %9s %10s %6s\n" % (
+        "zone", "count", "min us", "mean us", "p50 us", "p99 us", "max us", "total ms", "share"))
+    for name, cycles in zip(profile.zones, profile.cycles):
+        if not cycles:
+            out.write("%-12s %7d\n" % (name, 0))
+            continue
+        ordered = sorted(cycles)
+        out.write("%-12s %7d %9.1f %9.1f %9.1f %9.1f %9.1f %10.2f %5.1f%%\n" % (
+            name, len(ordered), ordered[0] * us, sum(ordered) * us / len(ordered),
+            percentile(ordered, 0.5) * us, percentile(ordered, 0.99) * us, ordered[-1] * us,
+            sum(ordered) * us / 1000, 100.0 * sum(ordered) / total))
+
+    for name, cycles in zip(profile.zones, profile.cycles):
+        if not cycles:
+            continue
+        # Power-of-two buckets in microseconds.
+        buckets = {}
+        for c in cycles:
+            bucket = max(0, int(c * us).bit_length() - 1)
+            buckets[bucket] = buckets.get(bucket, 0) + 1
+        peak = max(buckets.values())
+        out.write("\n%s\n" % name)
+        for bucket in range(min(buckets), max(buckets) + 1):
+            count = buckets.get(bucket, 0)
+            low = 0 if bucket == 0 else 1 << bucket
+            out.write("  %7d - %-7d us %7d %s\n" % (
+                low, (2 << bucket) - 1, count, "#" * ((count * BAR_WIDTH + peak - 1) // peak)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("capture", help="raw SWO capture, - for stdin")
+    parser.add_argument("--header", default=DEFAULT_HEADER, help="path to profiler.h")
+    parser.add_argument("--config", default=DEFAULT_CONFIG, help="path to profiler_config.h")
+    parser.add_argument("--port", type=int, help="ITM stimulus port (default from profiler_config.h)")
+    parser.add_argument("--clock-hz", type=int, default=CLOCK_HZ, help="DWT cycle counter frequency")
+    parser.add_argument("--words", action="store_true", help="input is the port's 32-bit words only")
+    args = parser.parse_args()
+
+    port = args.port if args.port is not None else load_port(args.config)
+    itm = ItmParser(port)
+    profile = Profile(load_zones(args.header))
+    stream = sys.stdin.buffer if args.capture == "-" else open(args.capture, "rb")
+    pending = bytearray()
+    with stream:
+        while True:
+            data = stream.read(4096)
+            if not data:
+                break
+            if args.words:
+                pending.extend(data)
+                whole = len(pending) - len(pending) % 4
+                profile.feed(int.from_bytes(pending[i:i + 4], "little") for i in range(0, whole, 4))
+                del pending[:whole]
+            else:
+                profile.feed(itm.feed(data))
+    report(profile, args.clock_hz, sys.stdout)
+    if itm.overflows or profile.unmatched or profile.unknown:
+        print("profiler_decode: %d ITM overflows, %d unmatched edges, %d unknown zones" % (
+            itm.overflows, profile.unmatched, profile.unknown), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()